@@ -0,0 +1,650 @@
+#pragma once
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <exception>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER)
+	#define STRTYPE_MSVC 1
+	#define STRTYPE_SIG __FUNCSIG__
+#elif defined(__GNUG__)
+	#define STRTYPE_GNUG 1
+	#define STRTYPE_SIG __PRETTY_FUNCTION__
+#else
+	#error Either __FUNCSIG__ (MSVC) or __PRETTY_FUNCTION__ (GCC/CLang) required
+#endif
+
+namespace strtype
+{
+	namespace details
+	{
+#pragma region fixed_string
+		template <size_t N>
+		struct fixed_string;
+
+		template <typename T>
+		struct is_fixed_string : std::false_type
+		{};
+		template <size_t N>
+		struct is_fixed_string<fixed_string<N>> : std::true_type
+		{};
+
+		template <typename T>
+		concept IsFixedString = is_fixed_string<std::remove_cvref_t<T>>::value;
+
+		template <size_t N>
+		struct fixed_string
+		{
+			static constexpr auto SIZE = N;
+			char buf[N + 1] {};
+			consteval fixed_string(char const* s)
+			{
+				for(size_t i = 0; i != N; ++i) buf[i] = s[i];
+			}
+
+			consteval fixed_string(const std::array<char, N>& s)
+			{
+				for(size_t i = 0; i != N; ++i) buf[i] = s[i];
+				buf[N] = '\0';
+			}
+			auto operator<=>(const fixed_string&) const = default;
+
+			constexpr char operator[](size_t index) const noexcept { return buf[index]; }
+
+			constexpr operator std::string_view() const noexcept { return std::string_view {buf, N}; }
+			constexpr operator char const*() const { return buf; }
+
+			constexpr auto size() const noexcept -> size_t { return N; }
+			constexpr auto empty() const noexcept -> bool { return size() == 0; }
+
+			template <size_t start, size_t end>
+			consteval auto substr() const noexcept -> fixed_string<end - start>
+			{
+				static_assert(start <= end);
+				static_assert(end <= N + 1);
+				return fixed_string<end - start> {&buf[start]};
+			}
+
+			consteval auto reverse() const noexcept -> fixed_string<SIZE>
+			{
+				std::array<char, SIZE> copy {};
+				constexpr auto halfpoint = (SIZE - (SIZE % 2)) / 2;
+				for(size_t i = 0; i != halfpoint; ++i)
+				{
+					copy[i]			   = buf[SIZE - i - 1];
+					copy[SIZE - i - 1] = buf[i];
+				}
+				if(SIZE % 2 != 0) copy[halfpoint] = buf[halfpoint];
+				return fixed_string<SIZE>(copy.data());
+			}
+
+			consteval auto to_lower() const noexcept -> fixed_string<SIZE>
+			{
+				std::array<char, SIZE> copy {};
+				for(size_t i = 0; i != SIZE; ++i)
+				{
+					copy[i] = (buf[i] >= 'A' && buf[i] <= 'Z') ? static_cast<char>(buf[i] - 'A' + 'a') : buf[i];
+				}
+				return fixed_string<SIZE> {copy};
+			}
+
+			consteval auto to_upper() const noexcept -> fixed_string<SIZE>
+			{
+				std::array<char, SIZE> copy {};
+				for(size_t i = 0; i != SIZE; ++i)
+				{
+					copy[i] = (buf[i] >= 'a' && buf[i] <= 'z') ? static_cast<char>(buf[i] - 'a' + 'A') : buf[i];
+				}
+				return fixed_string<SIZE> {copy};
+			}
+
+			constexpr auto begin() const noexcept { return buf; }
+			constexpr auto cbegin() const noexcept { return buf; }
+			constexpr auto end() const noexcept { return &buf[N]; }
+			constexpr auto cend() const noexcept { return &buf[N]; }
+		};
+		template <unsigned N>
+		fixed_string(char const (&)[N]) -> fixed_string<N - 1>;
+
+		template <size_t N>
+		fixed_string(const std::array<char, N>) -> fixed_string<N>;
+
+		template <size_t N, size_t M>
+		consteval auto operator+(const fixed_string<N>& lhs, const fixed_string<M>& rhs) -> fixed_string<N + M>
+		{
+			std::array<char, N + M> result {};
+			for(size_t i = 0; i != N; ++i) result[i] = lhs[i];
+			for(size_t i = 0; i != M; ++i) result[N + i] = rhs[i];
+			return fixed_string<N + M> {result};
+		}
+
+		template <size_t N, size_t M>
+		consteval auto operator+(const fixed_string<N>& lhs, const char (&rhs)[M]) -> fixed_string<N + M - 1>
+		{
+			return lhs + fixed_string<M - 1> {rhs};
+		}
+
+		template <size_t N, size_t M>
+		consteval auto operator+(const char (&lhs)[M], const fixed_string<N>& rhs) -> fixed_string<N + M - 1>
+		{
+			return fixed_string<M - 1> {lhs} + rhs;
+		}
+
+		template <size_t N>
+		consteval auto as_fixed_string(const fixed_string<N>& str) -> fixed_string<N>
+		{
+			return str;
+		}
+
+		template <size_t N>
+		consteval auto as_fixed_string(const char (&str)[N]) -> fixed_string<N - 1>
+		{
+			return fixed_string<N - 1> {str};
+		}
+#pragma endregion fixed_string
+#pragma region helpers
+		constexpr auto to_underlying(auto value) { return static_cast<std::underlying_type_t<decltype(value)>>(value); }
+
+#if !defined(__cpp_lib_is_scoped_enum)
+		// taken from cppreference: https://en.cppreference.com/w/cpp/types/is_scoped_enum
+		template <class T>
+		auto test_sizable(int) -> decltype(sizeof(T), std::true_type {});
+		template <class>
+		auto test_sizable(...) -> std::false_type;
+
+		template <class T>
+		auto test_nonconvertible_to_int(int)
+		  -> decltype(static_cast<std::false_type (*)(int)>(nullptr)(std::declval<T>()));
+		template <class>
+		auto test_nonconvertible_to_int(...) -> std::true_type;
+
+		template <class T>
+		inline constexpr bool is_scoped_enum_impl =
+		  std::conjunction_v<decltype(test_sizable<T>(0)), decltype(test_nonconvertible_to_int<T>(0))>;
+
+		template <class>
+		struct is_scoped_enum : std::false_type
+		{};
+
+		template <class E>
+			requires std::is_enum_v<E>
+		struct is_scoped_enum<E> : std::bool_constant<is_scoped_enum_impl<E>>
+		{};
+
+		template <typename T>
+		inline constexpr auto is_scoped_enum_v = is_scoped_enum<T>::value;
+#else
+		template <typename T>
+		inline constexpr auto is_scoped_enum_v = std::is_scoped_enum_v<T>;
+#endif
+
+		template <typename T>
+		concept IsValidStringifyableEnum = is_scoped_enum_v<T> && std::is_integral_v<std::underlying_type_t<T>>;
+
+		/// \brief all names stored back to back in a single buffer, indexed through an offset table.
+		template <size_t Count, size_t Bytes>
+		struct packed_names
+		{
+			std::array<char, Bytes> buffer {};
+			std::array<size_t, Count + 1> offsets {};
+
+			constexpr auto operator[](size_t index) const noexcept -> std::string_view
+			{
+				return std::string_view {buffer.data() + offsets[index], offsets[index + 1] - offsets[index]};
+			}
+			constexpr auto size() const noexcept -> size_t { return Count; }
+		};
+
+#pragma endregion helpers
+	}	 // namespace details
+
+#pragma region fixed_string_operations
+	using details::fixed_string;
+
+	/// \brief Concatenates any amount of `strtype::fixed_string`'s and string literals at compile time.
+	/// \details `operator+` does the same for two operands, e.g. `"net." + strtype::stringify<foo::a>()`.
+	template <typename... Strs>
+	consteval auto concat(const Strs&... strs)
+	{
+		return (fixed_string {""} + ... + details::as_fixed_string(strs));
+	}
+
+	/// \brief Concatenates the strings with the separator placed in between them, e.g. `join(".", "net", name)`.
+	template <typename Separator, typename First, typename... Rest>
+	consteval auto join(const Separator& separator, const First& first, const Rest&... rest)
+	{
+		return (details::as_fixed_string(first) + ... +
+				(details::as_fixed_string(separator) + details::as_fixed_string(rest)));
+	}
+
+	/// \brief Replaces every (non-overlapping) occurrence of `From` in `Str` with `To`, e.g.
+	/// `replace<strtype::stringify<foo::a_b>(), "_", ".">()`.
+	template <fixed_string Str, fixed_string From, fixed_string To>
+	consteval auto replace()
+	{
+		static_assert(!From.empty(), "the string to replace can't be empty");
+		constexpr auto for_each_match = [](auto&& callback) {
+			const std::string_view str {Str}, from {From};
+			size_t offset {0};
+			for(auto match = str.find(from); match != std::string_view::npos; match = str.find(from, offset))
+			{
+				callback(offset, match);
+				offset = match + from.size();
+			}
+			callback(offset, str.size());
+		};
+
+		constexpr auto size = [&for_each_match]() {
+			size_t result {0}, matches {0};
+			for_each_match([&](size_t begin, size_t end) {
+				result += end - begin;
+				++matches;
+			});
+			return result + (matches - 1) * To.size();
+		}();
+
+		std::array<char, size> result {};
+		size_t size_written {0};
+		bool first {true};
+		for_each_match([&](size_t begin, size_t end) {
+			if(!first)
+			{
+				for(size_t i = 0; i != To.size(); ++i) result[size_written++] = To[i];
+			}
+			for(size_t i = begin; i != end; ++i) result[size_written++] = Str[i];
+			first = false;
+		});
+		return fixed_string<size> {result};
+	}
+#pragma endregion fixed_string_operations
+
+	namespace details
+	{
+		template <auto Value>
+		consteval auto get_signature()
+		{
+			return details::fixed_string {STRTYPE_SIG};
+		}
+
+		template <typename T>
+		consteval auto get_signature()
+		{
+			return details::fixed_string {STRTYPE_SIG};
+		}
+
+		struct typename_signature_offset
+		{
+			static constexpr size_t value = []() constexpr -> size_t {
+				constexpr auto full_signature = get_signature<void>();
+#if defined(STRTYPE_MSVC)
+				size_t depth {0};
+				for(size_t i = 0; i < full_signature.size(); ++i)
+				{
+					size_t index = full_signature.size() - 1 - i;
+					if(full_signature[index] == '>')
+					{
+						++depth;
+					}
+					else if(full_signature[index] == '<')
+					{
+						if(depth == 0)
+						{
+							throw std::exception();
+						}
+						--depth;
+						if(depth == 0)
+						{
+							return index + 1;
+						}
+					}
+				}
+#elif defined(STRTYPE_GNUG)
+				for(size_t i = 0; i != full_signature.size(); ++i)
+				{
+					auto index = (full_signature.size() - 1) - i;
+					if(full_signature[index] == '=')
+					{
+						return index + 2;
+					}
+				}
+#endif
+				throw std::exception();
+			}();
+
+			// the signature is taken as an argument rather than as a template parameter, a `fixed_string` template
+			// parameter is an object that can end up in the binary, and this one holds the full signature.
+			template <size_t N>
+			static consteval auto transform(const fixed_string<N>& signature)
+			{
+#if defined(STRTYPE_MSVC)
+				constexpr auto end_offset = 7;	  // sizeof(">(void)")
+#elif defined(STRTYPE_GNUG)
+				constexpr auto end_offset = 1;	  // sizeof("]")
+#endif
+				return signature.template substr<value, N - end_offset>();
+			}
+		};
+
+		constexpr auto get_scope_impl(std::string_view str, char* buffer = nullptr) -> size_t
+		{
+			size_t total_size {0};
+#if defined(STRTYPE_MSVC)
+			constexpr std::string_view STRUCT {"struct "};
+			constexpr std::string_view CLASS {"class "};
+#endif
+			for(size_t i = 0; i < str.size(); ++i)
+			{
+#if defined(STRTYPE_MSVC)
+				if(str.substr(i, STRUCT.size()) == STRUCT)
+				{
+					i += STRUCT.size() - 1;
+				}
+				else if(str.substr(i, CLASS.size()) == CLASS)
+				{
+					i += CLASS.size() - 1;
+				}
+				else
+#endif
+				  if(str[i] == '<')
+				{
+					if(buffer) buffer[total_size] = str[i];
+					++total_size;
+				}
+				else if(str[i] == '>')
+				{
+					size_t to_modify = total_size;
+					if(str[i - 1] != ' ')
+					{
+						++total_size;
+					}
+					else
+					{
+						to_modify = total_size - 1;
+					}
+					if(buffer) buffer[to_modify] = str[i];
+				}
+				else
+				{
+					if(buffer) buffer[total_size] = str[i];
+					++total_size;
+					if(str[i] == ',' && str[i + 1] == ' ')
+					{
+						++i;
+					}
+				}
+			}
+			return total_size;
+		}
+
+		template <typename T>
+		consteval auto stringify_typename()
+		{
+			constexpr auto str	  = typename_signature_offset::transform(get_signature<T>());
+			constexpr auto size	  = get_scope_impl(str);
+			constexpr auto result = []<size_t size>(std::string_view str) constexpr {
+				std::array<char, size> result {};
+				get_scope_impl(str, result.data());
+				return result;
+			}.template operator()<size>(str);
+			return fixed_string {result};
+		}
+
+		template <auto KnownValue>
+		consteval auto get_known_offset() -> size_t
+		{
+			constexpr auto Str = get_signature<KnownValue>();
+			if(Str.size() == 0) throw std::exception();
+#if defined(STRTYPE_MSVC)
+			size_t depth {0};
+			for(auto i = 5; i < Str.size(); ++i)
+			{
+				auto index = (Str.size() - 1) - i;
+				if(Str[index] == '>')
+				{
+					++depth;
+				}
+				else if(Str[index] == '<')
+				{
+					--depth;
+					if(depth == 0)
+					{
+						throw std::exception();	   // not possible; should always be enum_class::value
+					}
+				}
+				else if(index > 0 && depth == 1 && Str[index] == ':' && Str[index - 1] == ':')
+				{
+					return index + 1;
+				}
+				else if(Str[index] == ')')
+				{
+					throw std::exception();
+				}
+			}
+#elif defined(STRTYPE_GNUG)
+			for(auto i = 0; i != Str.size(); ++i)
+			{
+				auto index = (Str.size() - 1) - i;
+				if(index > 0 && Str[index] == ':' && Str[index - 1] == ':')
+				{
+					return index + 1;
+				}
+				else if(index + 1 < Str.size() && Str[index] == ' ' && Str[index + 1] == '(')
+				{
+					throw std::exception();
+				}
+			}
+#endif
+			throw std::exception();	   // we couldn't find the start of the signature
+		}
+
+		// finds the start of the name of a value without knowing the offset of a named value up front. The name is the
+		// identifier at the end of the signature, preceded by the scope operator. Unnamed values are printed as a cast
+		// (e.g. `(foo)5`), where the identifier is preceded by something else.
+		// returns the size of the signature for unnamed values, for which `stringify_value_impl` returns an empty
+		// string.
+		template <auto Value>
+		consteval auto get_value_offset() -> size_t
+		{
+			constexpr auto Str = get_signature<Value>();
+#if defined(STRTYPE_MSVC)
+			constexpr size_t end_offset = 7;	// sizeof(">(void)")
+#elif defined(STRTYPE_GNUG)
+			constexpr size_t end_offset = 1;	// sizeof("]")
+#endif
+			constexpr auto is_identifier = [](char c) {
+				return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+			};
+
+			size_t index = Str.size() - end_offset;
+			while(index > 0 && is_identifier(Str[index - 1])) --index;
+			if(index == Str.size() - end_offset || index < 2 || Str[index - 1] != ':' || Str[index - 2] != ':')
+			{
+				return Str.size();
+			}
+			return index;
+		}
+
+		// CLang before 18 rejects a pointer to a subobject as a template argument, but accepts it as the member of a
+		// class type template argument.
+		template <typename T>
+		struct member_pointer_wrapper
+		{
+			T pointer;
+		};
+
+		template <typename T>
+		struct is_member_pointer_wrapper : std::false_type
+		{};
+
+		template <typename T>
+		struct is_member_pointer_wrapper<member_pointer_wrapper<T>> : std::true_type
+		{};
+
+		/// \returns the pointer to a field in the form that is passed to `stringify_member_impl`.
+		template <typename T>
+		constexpr auto wrap_member_pointer(T* pointer) noexcept
+		{
+#if defined(STRTYPE_MSVC)
+			return pointer;
+#elif defined(STRTYPE_GNUG)
+			return member_pointer_wrapper<T*> {pointer};
+#endif
+		}
+
+		// the bounds of the name of a data member in the signature of a pointer to it as a subobject of a static
+		// instance. The pointer is printed as its access path (e.g. `(& obj.wrapper::value.foo::field)` on GCC), so
+		// the name is the identifier at the end, optionally followed by the closing parenthesis. When the pointer is
+		// wrapped (see `member_pointer_wrapper`) the path is enclosed in braces, e.g.
+		// `wrapper<int*>{&obj.value.field}` on CLang.
+		constexpr auto get_member_bounds(std::string_view signature) -> std::pair<size_t, size_t>
+		{
+			constexpr auto is_identifier = [](char c) {
+				return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+			};
+
+			size_t end = signature.size();
+			if(end > 0 && signature[end - 1] == '}') --end;
+			if(end > 0 && signature[end - 1] == ')') --end;
+			size_t begin = end;
+			while(begin > 0 && is_identifier(signature[begin - 1])) --begin;
+			if(begin == end) throw std::exception(/* not a pointer to a named member */);
+			return {begin, end};
+		}
+
+		template <auto Pointer>
+			requires(std::is_pointer_v<decltype(Pointer)> ||
+					 is_member_pointer_wrapper<std::remove_cv_t<decltype(Pointer)>>::value)
+		consteval auto stringify_member_impl()
+		{
+			constexpr auto full_signature = get_signature<Pointer>();
+#if defined(STRTYPE_MSVC)
+			constexpr size_t end_offset = 7;	// sizeof(">(void)")
+#elif defined(STRTYPE_GNUG)
+			constexpr size_t end_offset = 1;	// sizeof("]")
+#endif
+			constexpr auto bounds =
+			  get_member_bounds(std::string_view {full_signature}.substr(0, full_signature.size() - end_offset));
+			return full_signature.template substr<bounds.first, bounds.second>();
+		}
+
+		// the signature of a value is laid out as `<prefix><value><suffix>`, where the prefix is the same for every
+		// value.
+		inline constexpr size_t value_signature_prefix = []() constexpr -> size_t {
+			constexpr auto full_signature = get_signature<0>();
+#if defined(STRTYPE_MSVC)
+			constexpr size_t end_offset = 7;	// sizeof(">(void)")
+#elif defined(STRTYPE_GNUG)
+			constexpr size_t end_offset = 1;	// sizeof("]")
+#endif
+			return full_signature.size() - end_offset - 1;	  // sizeof("0")
+		}();
+
+		// a named value is printed as `<typename>::<name>`, so the offset of the name in the signature is the same for
+		// every named value of the enum, and only has to be computed once per enum type.
+		template <typename T>
+		consteval auto get_enum_value_offset() -> size_t
+		{
+			constexpr auto type_name = typename_signature_offset::transform(get_signature<T>());
+			std::string_view name {type_name};
+#if defined(STRTYPE_MSVC)
+			// MSVC prints the type as `enum foo`, but its values as `foo::value`
+			if(name.starts_with("enum ")) name.remove_prefix(5);
+#endif
+			return value_signature_prefix + name.size() + 2;	// sizeof("::")
+		}
+
+		template <typename T>
+		inline constexpr size_t enum_value_offset = get_enum_value_offset<T>();
+
+		// verifies the per type offset against the signature of a value, unnamed values (printed as a cast) and any
+		// compiler that prints the typename differently fail this check.
+		template <size_t N>
+		constexpr auto is_name_offset(const fixed_string<N>& signature, size_t offset) noexcept -> bool
+		{
+			return offset >= 2 && offset < N && signature[offset - 1] == ':' && signature[offset - 2] == ':' &&
+				   (signature[offset] < '0' || signature[offset] > '9') && signature[offset] != ')';
+		}
+
+		template <auto Value, size_t known_offset>
+			requires(details::is_scoped_enum_v<decltype(Value)>)
+		consteval auto stringify_value_impl()
+		{
+			constexpr auto full_signature = details::get_signature<Value>();
+#if defined(STRTYPE_MSVC)
+			constexpr auto end_offset = 7;	  // sizeof(">(void)")
+#elif defined(STRTYPE_GNUG)
+			constexpr auto end_offset = 1;	  // sizeof("]")
+#endif
+
+			if constexpr(full_signature.size() <= known_offset)
+			{
+				return details::fixed_string {""};
+			}
+			else
+			{
+				if constexpr(full_signature[known_offset - 1] == ':')
+				{
+					return full_signature.template substr<known_offset, full_signature.size() - end_offset>();
+				}
+				else
+				{
+					return details::fixed_string {""};
+				}
+			}
+		}
+	}	 // namespace details
+
+	// returns the value of the given enum as a cross platform (MSVC, GCC, and CLang) consistent fixed_string, or an
+	// empty string when the value isn't named. The offset of the name is shared by all values of the enum, and is the
+	// same one the searchers use, so a value that was already found by a search is not parsed again.
+	template <auto Value>
+		requires(details::is_scoped_enum_v<decltype(Value)>)
+	consteval auto stringify()
+	{
+		constexpr auto offset = details::enum_value_offset<decltype(Value)>;
+		if constexpr(details::is_name_offset(details::get_signature<Value>(), offset))
+			return details::stringify_value_impl<Value, offset>();
+		else
+			return details::stringify_value_impl<Value, details::get_value_offset<Value>()>();
+	}
+
+	template <typename T>
+		requires(!details::IsValidStringifyableEnum<T>)
+	consteval auto stringify()
+	{
+		return details::stringify_typename<T>();
+	}
+
+	template <typename T>
+	consteval auto stringify_typename()
+	{
+		return details::stringify_typename<T>();
+	}
+
+	template <typename T>
+	consteval auto stringify_namespace()
+	{
+		constexpr auto value = stringify_typename<T>();
+		constexpr auto end	 = [](std::string_view value) {
+			  auto offset = value.find('<');
+			  auto end = value.rfind(':', offset);
+			  return (end != std::string_view::npos && end > 0 && value[end - 1] == ':') ? end -1 : 0;
+		}(value);
+
+		return value.template substr<0, end>();
+	}
+
+	template<typename T>
+	consteval auto is_templated_type() noexcept -> bool
+	{
+		constexpr auto value = stringify_typename<T>();
+		return std::string_view {value}.find('<') != std::string_view::npos;
+	}
+}	 // namespace strtype
+
+#undef STRTYPE_MSVC
+#undef STRTYPE_GNUG
+#undef STRTYPE_SIG
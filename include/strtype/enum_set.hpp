@@ -0,0 +1,132 @@
+#pragma once
+#include "strtype/map.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+namespace strtype
+{
+	namespace details
+	{
+		/// \brief matches the name against a glob pattern, where '*' matches any (possibly empty) run of characters and
+		/// '?' matches a single character.
+		/// \details Greedy with backtracking to the last '*', so it runs in O(pattern * name) at worst.
+		constexpr auto glob_match(std::string_view pattern, std::string_view name) noexcept -> bool
+		{
+			size_t p {0}, n {0};
+			size_t star {std::string_view::npos}, star_name {0};
+			while(n < name.size())
+			{
+				if(p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+				{
+					++p;
+					++n;
+				}
+				else if(p < pattern.size() && pattern[p] == '*')
+				{
+					star	  = p++;
+					star_name = n;
+				}
+				else if(star != std::string_view::npos)
+				{
+					// let the last '*' swallow one more character, and retry the rest of the pattern
+					p = star + 1;
+					n = ++star_name;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			while(p < pattern.size() && pattern[p] == '*') ++p;
+			return p == pattern.size();
+		}
+	}	 // namespace details
+
+	/// \brief Set of values of an enum, stored as a bitmask over their ordinals (see `strtype::enum_ordinal`).
+	/// \details Testing a value is a lookup of its ordinal (a direct index for dense enums) followed by a single bit
+	/// test.
+	template <details::IsValidStringifyableEnum T>
+	struct enum_set
+	{
+	  public:
+		static constexpr auto SIZE = stringify_map_v<T>.size();
+
+		constexpr enum_set() = default;
+
+		/// \returns true when the value is part of the set, values that aren't named are never part of it.
+		constexpr auto contains(T value) const noexcept -> bool { return test(stringify_map_v<T>.find_index(value)); }
+
+		/// \returns true when the value at the ordinal is part of the set.
+		constexpr auto test(size_t ordinal) const noexcept -> bool
+		{
+			return ordinal < SIZE && (m_Words[ordinal / WORD_BITS] >> (ordinal % WORD_BITS)) & 1;
+		}
+
+		constexpr auto insert(T value) -> void { set(stringify_map_v<T>.index_of(value), true); }
+		constexpr auto erase(T value) -> void { set(stringify_map_v<T>.index_of(value), false); }
+
+		constexpr auto set(size_t ordinal, bool enabled) -> void
+		{
+			if(ordinal >= SIZE) throw std::exception(/* out of range */);
+			const auto bit = word_t {1} << (ordinal % WORD_BITS);
+			auto& word	   = m_Words[ordinal / WORD_BITS];
+			word		   = enabled ? (word | bit) : (word & ~bit);
+		}
+
+		/// \returns the amount of values in the set.
+		constexpr auto count() const noexcept -> size_t
+		{
+			size_t result {0};
+			for(auto word : m_Words) result += std::popcount(word);
+			return result;
+		}
+		constexpr auto empty() const noexcept -> bool { return count() == 0; }
+
+		constexpr auto operator|=(const enum_set& other) noexcept -> enum_set&
+		{
+			for(size_t i = 0; i < WORDS; ++i) m_Words[i] |= other.m_Words[i];
+			return *this;
+		}
+		constexpr auto operator&=(const enum_set& other) noexcept -> enum_set&
+		{
+			for(size_t i = 0; i < WORDS; ++i) m_Words[i] &= other.m_Words[i];
+			return *this;
+		}
+		friend constexpr auto operator|(enum_set lhs, const enum_set& rhs) noexcept -> enum_set { return lhs |= rhs; }
+		friend constexpr auto operator&(enum_set lhs, const enum_set& rhs) noexcept -> enum_set { return lhs &= rhs; }
+
+		/// \returns the set of all named values that aren't in this set.
+		constexpr auto operator~() const noexcept -> enum_set
+		{
+			enum_set result {};
+			for(size_t i = 0; i < SIZE; ++i) result.set(i, !test(i));
+			return result;
+		}
+
+		constexpr auto operator==(const enum_set&) const noexcept -> bool = default;
+
+	  private:
+		using word_t						= std::uint64_t;
+		static constexpr size_t WORD_BITS	= sizeof(word_t) * 8;
+		static constexpr size_t WORDS		= SIZE > 0 ? (SIZE + WORD_BITS - 1) / WORD_BITS : 1;
+
+		word_t m_Words[WORDS] {};
+	};
+
+	/// \brief The set of values whose names match the glob pattern, '*' matches any run of characters and '?' a single
+	/// character (e.g. "NET_*" or "*_ERROR").
+	/// \details Works both at compile time for literal patterns, and at runtime for patterns loaded from a config. The
+	/// names are only matched once, afterwards testing a value is a single bit test through `enum_set::contains`.
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto match_names(std::string_view pattern) -> enum_set<T>
+	{
+		enum_set<T> result {};
+		for(size_t i = 0; i < stringify_map_v<T>.size(); ++i)
+		{
+			if(details::glob_match(pattern, stringify_map_v<T>.string_at_index(i))) result.set(i, true);
+		}
+		return result;
+	}
+}	 // namespace strtype
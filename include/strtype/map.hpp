@@ -0,0 +1,657 @@
+#pragma once
+#include "strtype/searchers.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#if defined(_MSC_VER)
+	#define STRTYPE_FORCEINLINE __forceinline
+#elif defined(__GNUG__)
+	#define STRTYPE_FORCEINLINE [[gnu::always_inline]] inline
+#else
+	#define STRTYPE_FORCEINLINE inline
+#endif
+
+// only SSE2, which every x86-64 target has, so that the comparisons don't depend on per translation unit ISA flags,
+// which would give the same inline functions different definitions
+#if defined(__x86_64__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define STRTYPE_SSE2
+#endif
+
+namespace strtype
+{
+	namespace details
+	{
+#pragma region helpers
+		// index of the first occurence of T in the pack, or sizeof...(Ts) when it isn't present
+		template <typename T, typename... Ts>
+		consteval auto type_index() -> size_t
+		{
+			size_t index {0};
+			((std::is_same_v<T, Ts> ? true : (++index, false)) || ...);
+			return index;
+		}
+
+		template <typename... Ts>
+		consteval auto is_unique_pack() -> bool
+		{
+			// every type should be found at its own position, otherwise an earlier duplicate shadows it
+			return []<size_t... Indices>(std::index_sequence<Indices...>) {
+				return ((type_index<Ts, Ts...>() == Indices) && ...);
+			}(std::index_sequence_for<Ts...> {});
+		}
+
+#pragma endregion helpers
+#pragma region compile_time_map
+		STRTYPE_FORCEINLINE constexpr std::uint32_t fnv1a_32(std::string_view value)
+		{
+			std::uint32_t seed {2166136261u};
+			const char* data = value.data();
+			const auto size	 = value.size();
+			for(size_t i = 0; i < size; ++i)
+			{
+				seed ^= data[i] * 16777619u;
+			}
+			return seed;
+		}
+
+		template <size_t Size>
+		inline constexpr std::uint32_t fnv1a_32(const std::array<std::byte, Size>& value)
+		{
+			std::uint32_t seed {2166136261u};
+			for(auto c : value)
+			{
+				seed ^= std::uint8_t(c) * 16777619u;
+			}
+			return seed;
+		}
+
+		template <typename T>
+			requires(std::is_integral_v<T>)
+		constexpr auto to_byte_array(const T& value) -> std::array<std::byte, sizeof(T) / sizeof(std::byte)>
+		{
+			constexpr auto S = sizeof(T) / sizeof(std::byte);
+			size_t offset	 = (S - 1) * 8;
+			std::array<std::byte, S> result {};
+			for(auto i = 1; i < S; ++i)
+			{
+				auto index	  = S - (i);
+				result[index] = std::byte((value >> offset) & 255);
+				offset -= 8;
+			}
+			result[0] = std::byte(value & 255);
+			return result;
+		}
+
+		template <typename T>
+			requires(std::is_integral_v<T>)
+		inline constexpr std::uint32_t fnv1a_32(const T& value)
+		{
+			return fnv1a_32(to_byte_array<T>(value));
+		}
+
+		// plain loops and pointer access, so that unoptimized builds don't pay for calls into the standard library
+		STRTYPE_FORCEINLINE constexpr auto names_equal(std::string_view lhs, std::string_view rhs) noexcept -> bool
+		{
+			const auto size = lhs.size();
+			if(size != rhs.size()) return false;
+			const char* lhs_data = lhs.data();
+			const char* rhs_data = rhs.data();
+			for(size_t i = 0; i < size; ++i)
+			{
+				if(lhs_data[i] != rhs_data[i]) return false;
+			}
+			return true;
+		}
+
+		/// \returns the slot size (see `ct_bst`) that fits names up to the given length, or 0 when they don't fit any.
+		consteval auto name_slot_size(size_t max_length) -> size_t
+		{
+			return max_length <= 16 ? 16 : (max_length <= 32 ? 32 : 0);
+		}
+
+		// compares two zero padded, `SlotSize` aligned, slots with one SSE2 compare per 16 bytes where available
+		template <size_t SlotSize>
+		STRTYPE_FORCEINLINE auto slots_equal(const char* lhs, const char* rhs) noexcept -> bool
+		{
+#if defined(STRTYPE_SSE2)
+			if constexpr(SlotSize == 16)
+			{
+				const auto equal = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(lhs)),
+												  _mm_load_si128(reinterpret_cast<const __m128i*>(rhs)));
+				return _mm_movemask_epi8(equal) == 0xFFFF;
+			}
+			if constexpr(SlotSize == 32)
+			{
+				const auto low	= _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(lhs)),
+												 _mm_load_si128(reinterpret_cast<const __m128i*>(rhs)));
+				const auto high = _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(lhs + 16)),
+												 _mm_load_si128(reinterpret_cast<const __m128i*>(rhs + 16)));
+				return _mm_movemask_epi8(_mm_and_si128(low, high)) == 0xFFFF;
+			}
+#endif
+			// scalar fallback, compared a word at a time
+			std::uint64_t difference {0};
+			for(size_t i = 0; i < SlotSize; i += sizeof(std::uint64_t))
+			{
+				std::uint64_t lhs_word, rhs_word;
+				std::memcpy(&lhs_word, lhs + i, sizeof(std::uint64_t));
+				std::memcpy(&rhs_word, rhs + i, sizeof(std::uint64_t));
+				difference |= lhs_word ^ rhs_word;
+			}
+			return difference == 0;
+		}
+
+		/// \returns the index of the first element that has a `first` member equal or larger than `key`
+		template <typename Pair, typename Key>
+		STRTYPE_FORCEINLINE constexpr auto lower_bound_index(const Pair* data, size_t size, Key key) noexcept -> size_t
+		{
+			size_t first {0};
+			while(size > 0)
+			{
+				const size_t step = size / 2;
+				if(data[first + step].first < key)
+				{
+					first += step + 1;
+					size -= step + 1;
+				}
+				else
+				{
+					size = step;
+				}
+			}
+			return first;
+		}
+
+		/// \brief compile time map in between the names and values of an enum.
+		/// \tparam SlotSize when 16 or 32, every name is also stored zero padded in an aligned slot of this size, so
+		/// that a runtime string lookup confirms the hash match with vector compares. Every name has to fit.
+		template <typename T, size_t Size, size_t SlotSize = 0>
+		struct ct_bst
+		{
+			static_assert(SlotSize == 0 || SlotSize == 16 || SlotSize == 32, "the slot size should be 0, 16 or 32");
+
+		  public:
+			static constexpr auto SIZE		= Size;
+			static constexpr auto SLOT_SIZE = SlotSize;
+			using enum_type			   = T;
+			using underlying_t		   = std::underlying_type_t<T>;
+			using string_hash_pair_t   = std::pair<std::uint32_t, size_t>;	  // hash + index
+			using value_hash_pair_t	   = std::pair<underlying_t, size_t>;	  // hash + index
+			using value_pair_t		   = std::pair<std::string_view, T>;
+			consteval ct_bst(const auto& strs, const auto& values)
+			{
+				// iterate over all values, turn them into hashed values, and then sort them based on hashes.
+				for(size_t i = 0; i < values.size(); ++i)
+				{
+					m_Data[i]		= value_pair_t {strs[i], values[i]};
+					m_StringHash[i] = string_hash_pair_t {fnv1a_32(m_Data[i].first), i};
+					m_ValueHash[i]	= value_hash_pair_t {to_underlying<T>(m_Data[i].second), i};
+					if constexpr(SlotSize > 0)
+					{
+						if(m_Data[i].first.size() > SlotSize) throw std::exception(/* the name doesn't fit the slot */);
+						for(size_t c = 0; c < m_Data[i].first.size(); ++c) m_Slots[i][c] = m_Data[i].first[c];
+					}
+				}
+				std::sort(m_StringHash, m_StringHash + Size, [](const auto& lhs, const auto& rhs) {
+					return lhs.first < rhs.first;
+				});
+				std::sort(m_ValueHash, m_ValueHash + Size, [](const auto& lhs, const auto& rhs) {
+					return lhs.first < rhs.first;
+				});
+
+				if(std::adjacent_find(m_StringHash, m_StringHash + Size, [](const auto& lhs, const auto& rhs) {
+					   return lhs.first == rhs.first;
+				   }) == m_StringHash + Size)
+				{
+					m_PerfectHash = true;
+				}
+
+				if(std::adjacent_find(m_ValueHash, m_ValueHash + Size, [](const auto& lhs, const auto& rhs) {
+					   return lhs.first == rhs.first;
+				   }) != m_ValueHash + Size)
+				{
+					throw std::exception();
+				}
+
+				// values are unique, so when the range is as large as the amount of values there are no holes
+				if constexpr(Size > 0)
+				{
+					m_Dense = static_cast<std::uint64_t>(m_ValueHash[Size - 1].first) -
+								static_cast<std::uint64_t>(m_ValueHash[0].first) ==
+							  Size - 1;
+				}
+			}
+
+			STRTYPE_FORCEINLINE constexpr auto operator[](std::string_view value) const -> T
+			{
+				const auto index = find_index(value);
+				if(index != Size) return m_Data[index].second;
+				throw std::exception(/* missing value */);
+			}
+
+			STRTYPE_FORCEINLINE constexpr auto operator[](T value) const -> std::string_view
+			{
+				return m_Data[index_of(value)].first;
+			}
+
+			/// \returns the ordinal of the value, i.e. its position when iterating over the container.
+			STRTYPE_FORCEINLINE constexpr auto index_of(T value) const -> size_t
+			{
+				const auto index = find_index(value);
+				if(index != Size) return index;
+				throw std::exception(/* missing value */);
+			}
+
+			/// \returns the ordinal of the name, or `size()` when it isn't present.
+			STRTYPE_FORCEINLINE constexpr auto find_index(std::string_view value) const noexcept -> size_t
+			{
+				const auto hash = fnv1a_32(value);
+				if constexpr(SlotSize > 0)
+				{
+					if(!std::is_constant_evaluated())
+					{
+						if(value.size() > SlotSize) return Size;
+						alignas(SlotSize) char query[SlotSize] {};
+						std::memcpy(query, value.data(), value.size());
+						for(auto i = lower_bound_index(m_StringHash, Size, hash);
+							i < Size && m_StringHash[i].first == hash;
+							++i)
+						{
+							// the size check rejects queries that only match because of embedded zeroes
+							const auto index = m_StringHash[i].second;
+							if(m_Data[index].first.size() == value.size() &&
+							   slots_equal<SlotSize>(m_Slots[index], query))
+								return index;
+						}
+						return Size;
+					}
+				}
+
+				// the hashes are sorted, so all candidates are adjacent (and there's only one with a perfect hash)
+				for(auto i = lower_bound_index(m_StringHash, Size, hash); i < Size && m_StringHash[i].first == hash;
+					++i)
+				{
+					if(names_equal(m_Data[m_StringHash[i].second].first, value)) return m_StringHash[i].second;
+				}
+				return Size;
+			}
+
+			/// \returns the ordinal of the value, or `size()` when it isn't present.
+			STRTYPE_FORCEINLINE constexpr auto find_index(T value) const noexcept -> size_t
+			{
+				const auto underlying = static_cast<underlying_t>(value);
+				if(m_Dense)
+				{
+					// the sorted values have no holes, so the distance to the smallest value is the position
+					const auto offset =
+					  static_cast<std::uint64_t>(underlying) - static_cast<std::uint64_t>(m_ValueHash[0].first);
+					return offset < Size ? m_ValueHash[offset].second : Size;
+				}
+
+				const auto i = lower_bound_index(m_ValueHash, Size, underlying);
+				return (i < Size && m_ValueHash[i].first == underlying) ? m_ValueHash[i].second : Size;
+			}
+
+			constexpr auto size() const noexcept -> size_t { return Size; }
+			constexpr auto begin() const noexcept { return m_Data + 0; }
+			constexpr auto cbegin() const noexcept { return m_Data + 0; }
+			constexpr auto end() const noexcept { return m_Data + Size; }
+			constexpr auto cend() const noexcept { return m_Data + Size; }
+
+			constexpr auto string_at_index(size_t i) const noexcept -> const std::string_view&
+			{
+				return m_Data[i].first;
+			}
+			constexpr auto value_at_index(size_t i) const noexcept -> const T& { return m_Data[i].second; }
+
+			/// \returns true when every name has a unique hash, so a lookup compares a single candidate.
+			constexpr auto is_perfect_hash() const noexcept -> bool { return m_PerfectHash; }
+			/// \returns true when the values have no holes, so a value lookup is a direct index.
+			constexpr auto is_dense() const noexcept -> bool { return m_Dense; }
+
+			/// \returns the amount of names that share their hash with the previous name (in hash order).
+			constexpr auto hash_collisions() const noexcept -> size_t
+			{
+				size_t result {0};
+				for(size_t i = 1; i < Size; ++i) result += m_StringHash[i - 1].first == m_StringHash[i].first ? 1 : 0;
+				return result;
+			}
+
+		  private:
+			// C arrays rather than std::array, so that unoptimized builds index directly instead of calling operator[]
+			static constexpr auto STORAGE_SIZE		= Size > 0 ? Size : 1;
+			static constexpr auto SLOT_STORAGE_SIZE = SlotSize > 0 ? STORAGE_SIZE : 1;
+
+			string_hash_pair_t m_StringHash[STORAGE_SIZE] {};
+			value_hash_pair_t m_ValueHash[STORAGE_SIZE] {};
+			value_pair_t m_Data[STORAGE_SIZE] {};
+			alignas(SlotSize > 0 ? SlotSize : 1) char m_Slots[SLOT_STORAGE_SIZE][SlotSize > 0 ? SlotSize : 1] {};
+			bool m_PerfectHash {false};
+			bool m_Dense {false};
+		};
+
+#pragma endregion compile_time_map
+	}	 // namespace details
+
+	/// \brief Compile time stringify your enum into an associative container from the range BEGIN to END
+	/// \tparam Searcher Searcher functional object that can iterate, and return the values (see `strtype::sequential_searcher` for example)
+	/// \tparam T enum type that satisfies the constraint
+	/// \tparam Begin start of the range (inclusive) to stringify
+	/// \tparam End end of the range (inclusive if decltype(End) == T, otherwise exclusive)
+	/// \returns an associative container where you can either iterate over the enum values as an std::pair<std::string_view, T>, or where you can use the bracker operator to efficiently convert string to T and vice-versa.
+	template <details::IsValidStringifyableEnum T,
+			  auto Begin		= details::search_begin<T>(),
+			  auto End			= details::search_end<T>(),
+			  typename Searcher = typename enum_information<T>::SEARCHER>
+	consteval auto stringify_map()
+	{
+		constexpr auto begin = details::guarantee_is_underlying_value<T, Begin>();
+		constexpr auto end	 = details::guarantee_is_underlying_value<T, End, true>();
+		static_assert(begin < end, "The end value should be larger than begin");
+		constexpr auto values_pair = details::get_unique_entries<T, begin, end, Searcher, false>();
+		constexpr auto slot_size   = details::name_slot_size(details::max_name_length(values_pair.first));
+		return details::ct_bst<T, values_pair.first.size(), slot_size>(values_pair.first, values_pair.second);
+	}
+
+	/// \brief The result of `strtype::stringify_map<T>()` as a single statically stored object.
+	/// \details Prefer this over a function local `constexpr auto map = stringify_map<T>();` in runtime code, as the
+	/// compiler is free to (and at low optimization levels will) materialize a local copy of the map on every call.
+	template <details::IsValidStringifyableEnum T>
+	inline constexpr auto stringify_map_v = stringify_map<T>();
+
+	namespace details
+	{
+		/// \brief associative container over the combined names of several enums
+		/// \details All names share a single hash table, so one probe resolves both the enum type and its value. Names
+		/// have to be unique across all the enums, which is verified at compile time. Value to name lookups go through
+		/// `stringify_map_v` of the enum, so the maps themselves are not duplicated in this container.
+		template <typename... Ts>
+		struct ct_union_bst
+		{
+		  public:
+			static constexpr auto SIZE = (stringify_map_v<Ts>.size() + ...);
+			using string_hash_pair_t   = std::pair<std::uint32_t, size_t>;	  // hash + index
+			using variant_t			   = std::variant<Ts...>;
+			using value_pair_t		   = std::pair<std::string_view, variant_t>;
+
+			consteval ct_union_bst()
+			{
+				size_t offset {0};
+				constexpr auto fill = [](auto& dst, const auto& map, size_t& offset) constexpr {
+					for(size_t i = 0; i < map.size(); ++offset, ++i)
+					{
+						dst[offset] = value_pair_t {map.string_at_index(i), variant_t {map.value_at_index(i)}};
+					}
+				};
+				(fill(m_Data, stringify_map_v<Ts>, offset), ...);
+
+				for(size_t i = 0; i < SIZE; ++i)
+				{
+					m_StringHash[i] = string_hash_pair_t {fnv1a_32(m_Data[i].first), i};
+				}
+				std::sort(m_StringHash, m_StringHash + SIZE, [](const auto& lhs, const auto& rhs) {
+					return lhs.first < rhs.first;
+				});
+
+				m_PerfectHash = true;
+				for(size_t i = 1; i < SIZE; ++i)
+				{
+					if(m_StringHash[i - 1].first != m_StringHash[i].first) continue;
+					m_PerfectHash = false;
+
+					// walk the entire run of equal hashes, any equal name means a clash between two enums
+					for(size_t j = i; j < SIZE && m_StringHash[j].first == m_StringHash[i - 1].first; ++j)
+					{
+						if(m_Data[m_StringHash[i - 1].second].first == m_Data[m_StringHash[j].second].first)
+						{
+							throw std::exception(/* the same name is present in multiple enums */);
+						}
+					}
+				}
+			}
+
+			/// \returns a pointer to the matching entry, or `end()` when the name is not present in any of the enums.
+			STRTYPE_FORCEINLINE constexpr auto find(std::string_view value) const -> const value_pair_t*
+			{
+				const auto hash = fnv1a_32(value);
+				for(auto i = lower_bound_index(m_StringHash, SIZE, hash); i < SIZE && m_StringHash[i].first == hash;
+					++i)
+				{
+					if(names_equal(m_Data[m_StringHash[i].second].first, value)) return m_Data + m_StringHash[i].second;
+				}
+				return end();
+			}
+
+			constexpr auto operator[](std::string_view value) const -> variant_t
+			{
+				auto it = find(value);
+				if(it != end()) return it->second;
+				throw std::exception(/* missing value */);
+			}
+
+			template <typename E>
+				requires(type_index<E, Ts...>() < sizeof...(Ts))
+			constexpr auto operator[](E value) const -> std::string_view
+			{
+				return stringify_map_v<E>[value];
+			}
+
+			constexpr auto size() const noexcept -> size_t { return SIZE; }
+			constexpr auto begin() const noexcept -> const value_pair_t* { return m_Data + 0; }
+			constexpr auto cbegin() const noexcept -> const value_pair_t* { return m_Data + 0; }
+			constexpr auto end() const noexcept -> const value_pair_t* { return m_Data + SIZE; }
+			constexpr auto cend() const noexcept -> const value_pair_t* { return m_Data + SIZE; }
+
+		  private:
+			static constexpr auto STORAGE_SIZE = SIZE > 0 ? SIZE : 1;
+
+			string_hash_pair_t m_StringHash[STORAGE_SIZE] {};
+			value_pair_t m_Data[STORAGE_SIZE] {};
+			bool m_PerfectHash {false};
+		};
+	}	 // namespace details
+
+	/// \brief Compile time stringify several enums into a single associative container
+	/// \details Every enum uses its own `enum_information` for the search range and searcher. The names are stored in a
+	/// single hash table, so a string lookup is one probe regardless of the amount of enums. Names that appear in more
+	/// than one of the enums will fail the compilation.
+	/// \tparam Ts unique enum types that satisfy the constraint
+	/// \returns an associative container that maps a string to an `std::variant<Ts...>`, and any of the enum values
+	/// back to their string representation.
+	template <details::IsValidStringifyableEnum... Ts>
+		requires(sizeof...(Ts) > 0 && details::is_unique_pack<Ts...>())
+	consteval auto stringify_union_map()
+	{
+		return details::ct_union_bst<Ts...> {};
+	}
+
+	/// \brief The result of `strtype::stringify_union_map<Ts...>()` as a single statically stored object.
+	template <details::IsValidStringifyableEnum... Ts>
+	inline constexpr auto stringify_union_map_v = stringify_union_map<Ts...>();
+
+	namespace details
+	{
+		template <typename Searcher, typename T, auto Begin, auto End>
+		concept SearcherHasCandidates = requires() { Searcher {}.template candidates<T, Begin, End>(); };
+
+		// enums with a searchable range (see `strtype::enum_information`), other types only have a typename.
+		template <typename T>
+		concept HasEnumTable = IsValidStringifyableEnum<T> && requires() { stringify_map<T>(); };
+
+		template <typename T>
+		inline constexpr auto typename_storage = stringify_typename<T>();
+	}	 // namespace details
+
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto stringify_enum(T value) -> std::string_view
+	{
+		return stringify_map_v<T>[value];
+	}
+
+	/// \returns the ordinal of the value in the `stringify<T>()` output, useful as a compact stand-in for the name.
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto enum_ordinal(T value) -> size_t
+	{
+		return stringify_map_v<T>.index_of(value);
+	}
+
+	namespace details
+	{
+		/// \brief the names in lexicographic order, and the rank of every ordinal in that order.
+		template <typename T, size_t Size>
+		struct name_rank_table
+		{
+			std::array<std::string_view, Size> names {};	// sorted by name
+			std::array<T, Size> values {};					// the value of every name in `names`
+			std::array<size_t, Size> ranks {};				// indexed by ordinal
+		};
+
+		template <typename T>
+		inline constexpr auto name_ranks = []() consteval {
+			constexpr const auto& map = stringify_map_v<T>;
+			std::array<size_t, map.size()> ordinals {};
+			for(size_t i = 0; i < ordinals.size(); ++i) ordinals[i] = i;
+			std::sort(std::begin(ordinals), std::end(ordinals), [&map](size_t lhs, size_t rhs) {
+				return map.string_at_index(lhs) < map.string_at_index(rhs);
+			});
+
+			name_rank_table<T, map.size()> result {};
+			for(size_t rank = 0; rank < ordinals.size(); ++rank)
+			{
+				result.names[rank]			 = map.string_at_index(ordinals[rank]);
+				result.values[rank]			 = map.value_at_index(ordinals[rank]);
+				result.ranks[ordinals[rank]] = rank;
+			}
+			return result;
+		}();
+	}	 // namespace details
+
+	/// \returns the position of the value's name in lexicographic (byte wise) order of all names, so sorting values by
+	/// name can compare integers instead of strings.
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto name_rank(T value) -> size_t
+	{
+		return details::name_ranks<T>.ranks[stringify_map_v<T>.index_of(value)];
+	}
+
+	/// \returns all names in lexicographic order, the index of a name is its `strtype::name_rank`.
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto names_sorted() noexcept -> std::span<const std::string_view, stringify_map_v<T>.size()>
+	{
+		return details::name_ranks<T>.names;
+	}
+
+	/// \returns the value whose name has the given `strtype::name_rank`.
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto value_at_rank(size_t rank) -> T
+	{
+		if(rank >= details::name_ranks<T>.values.size()) throw std::exception(/* out of range */);
+		return details::name_ranks<T>.values[rank];
+	}
+
+	/// \returns the names that start with the prefix as a subrange of `strtype::names_sorted<T>()` (found with two
+	/// binary searches), e.g. for autocompletion. The rank of the first name is its offset in `names_sorted<T>()`.
+	template <details::IsValidStringifyableEnum T>
+	constexpr auto names_with_prefix(std::string_view prefix) noexcept -> std::span<const std::string_view>
+	{
+		const std::span<const std::string_view> names = names_sorted<T>();
+		const auto first = std::lower_bound(std::begin(names), std::end(names), prefix);
+		const auto last	 = std::partition_point(
+			first, std::end(names), [prefix](std::string_view name) { return name.starts_with(prefix); });
+		return names.subspan(static_cast<size_t>(first - std::begin(names)), static_cast<size_t>(last - first));
+	}
+
+	/// \brief What was found for an enum, and how its lookups are laid out, as reported by `strtype::enum_stats<T>()`.
+	template <typename T>
+	struct enum_statistics
+	{
+		using underlying_t = std::underlying_type_t<T>;
+
+		std::string_view type_name {};
+		std::string_view searcher {};
+		underlying_t begin {};			// the searched range [begin, end)
+		underlying_t end {};
+		size_t candidates {0};			// values instantiated by the searcher
+		size_t count {0};				// named values that were found
+		double density {0.0};			// count / candidates
+		size_t name_bytes {0};			// sum of the name lengths
+		size_t max_name_length {0};
+		size_t hash_collisions {0};		// names that share their hash with another name
+		bool perfect_hash {false};		// string lookups compare a single candidate
+		bool dense {false};				// value lookups are a direct index instead of a binary search
+		size_t slot_size {0};			// see `details::ct_bst`, 0 when names are compared through their pointers
+	};
+
+	/// \brief Compile time statistics of the search and lookup tables of an enum.
+	/// \details Use this to find enums that waste their search budget (a low density), or that end up on a slower
+	/// lookup path. The `strtype_report` tool prints these for a list of enums.
+	template <details::IsValidStringifyableEnum T,
+			  auto Begin		= details::search_begin<T>(),
+			  auto End			= details::search_end<T>(),
+			  typename Searcher = typename enum_information<T>::SEARCHER>
+	consteval auto enum_stats() -> enum_statistics<T>
+	{
+		constexpr auto begin = details::guarantee_is_underlying_value<T, Begin>();
+		constexpr auto end	 = details::guarantee_is_underlying_value<T, End, true>();
+		constexpr auto map	 = stringify_map<T, Begin, End, Searcher>();
+
+		enum_statistics<T> result {details::typename_storage<T>, details::typename_storage<Searcher>, begin, end};
+		if constexpr(details::SearcherHasCandidates<Searcher, T, begin, end>)
+			result.candidates = Searcher {}.template candidates<T, begin, end>();
+		else
+			result.candidates = Searcher {}.template max_size<T, begin, end>();
+		result.count   = map.size();
+		result.density = result.candidates > 0 ? static_cast<double>(result.count) / result.candidates : 0.0;
+		for(const auto& [name, value] : map)
+		{
+			result.name_bytes += name.size();
+			result.max_name_length = name.size() > result.max_name_length ? name.size() : result.max_name_length;
+		}
+		result.hash_collisions = map.hash_collisions();
+		result.perfect_hash	   = map.is_perfect_hash();
+		result.dense		   = map.is_dense();
+		result.slot_size	   = map.SLOT_SIZE;
+		return result;
+	}
+
+	/// \brief Bytes of read-only data strtype emits for a type, as reported by `strtype::name_storage<T>()`.
+	/// \details Every name is a separate template parameter object that the linker merges across translation units, so
+	/// each is counted once. The typename and the map are only emitted when used at runtime.
+	struct name_storage_report
+	{
+		std::string_view type_name {};
+		size_t type_name_bytes {0};	   // `stringify_typename<T>()` including its terminator
+		size_t count {0};			   // amount of names, 0 for types without an enum table
+		size_t name_bytes {0};		   // all names including their terminators
+		size_t map_bytes {0};		   // `stringify_map_v<T>`
+
+		constexpr auto total() const noexcept -> size_t { return type_name_bytes + name_bytes + map_bytes; }
+	};
+
+	/// \returns the size report of the type, only the trimmed names are emitted, never the signatures they're parsed
+	/// from.
+	template <typename T>
+	consteval auto name_storage() -> name_storage_report
+	{
+		const std::string_view type_name = details::typename_storage<T>;
+		name_storage_report result {type_name, type_name.size() + 1};
+		if constexpr(details::HasEnumTable<T>)
+		{
+			for(const auto& [name, value] : stringify_map_v<T>) result.name_bytes += name.size() + 1;
+			result.count	 = stringify_map_v<T>.size();
+			result.map_bytes = sizeof(stringify_map_v<T>);
+		}
+		return result;
+	}
+}	 // namespace strtype
+
+#undef STRTYPE_FORCEINLINE
+#undef STRTYPE_SSE2
@@ -0,0 +1,644 @@
+#pragma once
+#include "strtype/core.hpp"
+
+#include <array>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace strtype
+{
+	namespace details
+	{
+		inline constexpr size_t max_member_count {32};
+
+		template <typename T>
+		concept IsReflectableAggregate = std::is_class_v<T> && std::is_aggregate_v<T>;
+
+#pragma region field_count
+		// converts into any field type, only used in unevaluated contexts to count the fields of `T`. The conversion to
+		// `T` itself is excluded, as `T {field}` would otherwise be a copy of a `T` rather than an initialization.
+		template <typename T>
+		struct any_field
+		{
+			template <typename U>
+				requires(!std::is_same_v<std::remove_cvref_t<U>, T>)
+			operator U() const noexcept;
+		};
+
+		template <typename T, size_t... Is>
+		consteval auto is_initializable_with(std::index_sequence<Is...>) -> bool
+		{
+			return requires { T {(static_cast<void>(Is), any_field<T> {})...}; };
+		}
+
+		// the field count is the largest amount of initializers the aggregate accepts. Every field is initialized by a
+		// single initializer, which does not hold for fields that are C arrays (brace elision spreads them out).
+		// Counting stops past `max_member_count`, the public functions reject such aggregates with a `static_assert`.
+		template <typename T, size_t Count = 0>
+		consteval auto field_count() -> size_t
+		{
+			if constexpr(Count > max_member_count)
+				return Count;
+			else if constexpr(is_initializable_with<T>(std::make_index_sequence<Count + 1> {}))
+				return field_count<T, Count + 1>();
+			else
+				return Count;
+		}
+#pragma endregion field_count
+#pragma region structured_bindings
+		/// \brief binds every field of the aggregate, and invokes the callback with all of them.
+		template <size_t Count, typename T, typename Callback>
+		constexpr auto visit_fields(T& obj, Callback&& callback) -> decltype(auto)
+		{
+			if constexpr(Count == 0)
+			{
+				return callback();
+			}
+			else if constexpr(Count == 1)
+			{
+				auto&& [f0] = obj;
+				return callback(f0);
+			}
+			else if constexpr(Count == 2)
+			{
+				auto&& [f0, f1] = obj;
+				return callback(f0, f1);
+			}
+			else if constexpr(Count == 3)
+			{
+				auto&& [f0, f1, f2] = obj;
+				return callback(f0, f1, f2);
+			}
+			else if constexpr(Count == 4)
+			{
+				auto&& [f0, f1, f2, f3] = obj;
+				return callback(f0, f1, f2, f3);
+			}
+			else if constexpr(Count == 5)
+			{
+				auto&& [f0, f1, f2, f3, f4] = obj;
+				return callback(f0, f1, f2, f3, f4);
+			}
+			else if constexpr(Count == 6)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5] = obj;
+				return callback(f0, f1, f2, f3, f4, f5);
+			}
+			else if constexpr(Count == 7)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6);
+			}
+			else if constexpr(Count == 8)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7);
+			}
+			else if constexpr(Count == 9)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+			}
+			else if constexpr(Count == 10)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+			}
+			else if constexpr(Count == 11)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+			}
+			else if constexpr(Count == 12)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+			}
+			else if constexpr(Count == 13)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+			}
+			else if constexpr(Count == 14)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+			}
+			else if constexpr(Count == 15)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+			}
+			else if constexpr(Count == 16)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+			}
+			else if constexpr(Count == 17)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+			}
+			else if constexpr(Count == 18)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17);
+			}
+			else if constexpr(Count == 19)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = obj;
+				return callback(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18);
+			}
+			else if constexpr(Count == 20)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19);
+			}
+			else if constexpr(Count == 21)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19,
+						f20] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20);
+			}
+			else if constexpr(Count == 22)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21);
+			}
+			else if constexpr(Count == 23)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22);
+			}
+			else if constexpr(Count == 24)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23);
+			}
+			else if constexpr(Count == 25)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24);
+			}
+			else if constexpr(Count == 26)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25);
+			}
+			else if constexpr(Count == 27)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25, f26] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25,
+								f26);
+			}
+			else if constexpr(Count == 28)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25, f26, f27] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25,
+								f26,
+								f27);
+			}
+			else if constexpr(Count == 29)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25, f26, f27, f28] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25,
+								f26,
+								f27,
+								f28);
+			}
+			else if constexpr(Count == 30)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25, f26, f27, f28, f29] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25,
+								f26,
+								f27,
+								f28,
+								f29);
+			}
+			else if constexpr(Count == 31)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25, f26, f27, f28, f29, f30] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25,
+								f26,
+								f27,
+								f28,
+								f29,
+								f30);
+			}
+			else if constexpr(Count == 32)
+			{
+				auto&& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+						f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31] = obj;
+				return callback(f0,
+								f1,
+								f2,
+								f3,
+								f4,
+								f5,
+								f6,
+								f7,
+								f8,
+								f9,
+								f10,
+								f11,
+								f12,
+								f13,
+								f14,
+								f15,
+								f16,
+								f17,
+								f18,
+								f19,
+								f20,
+								f21,
+								f22,
+								f23,
+								f24,
+								f25,
+								f26,
+								f27,
+								f28,
+								f29,
+								f30,
+								f31);
+			}
+		}
+#pragma endregion structured_bindings
+
+		template <size_t I, typename First, typename... Rest>
+		constexpr auto nth_field(First& first, Rest&... rest) noexcept -> auto&
+		{
+			if constexpr(I == 0)
+				return first;
+			else
+				return nth_field<I - 1>(rest...);
+		}
+
+		// never defined, only the addresses of its fields are used as template arguments
+		template <typename T>
+		struct fake_obj_wrapper
+		{
+			const T value;
+		};
+
+		template <typename T>
+		extern const fake_obj_wrapper<T> fake_obj;
+
+		template <typename T, size_t I>
+		consteval auto member_pointer()
+		{
+			return visit_fields<field_count<T>()>(fake_obj<T>.value, [](auto&... fields) {
+				return wrap_member_pointer(&nth_field<I>(fields...));
+			});
+		}
+
+		template <typename T, size_t... Is>
+		consteval auto make_member_names(std::index_sequence<Is...>)
+		{
+			constexpr size_t bytes = (size_t {0} + ... + stringify_member_impl<member_pointer<T, Is>()>().size());
+			packed_names<sizeof...(Is), bytes> result {};
+			size_t index {0};
+			[[maybe_unused]] const auto append = [&result, &index](std::string_view name) {
+				for(size_t i = 0; i < name.size(); ++i) result.buffer[result.offsets[index] + i] = name[i];
+				result.offsets[index + 1] = result.offsets[index] + name.size();
+				++index;
+			};
+			(append(stringify_member_impl<member_pointer<T, Is>()>()), ...);
+			return result;
+		}
+
+		// statically stored so that all returned `std::string_view`'s point into a single table.
+		template <typename T>
+		inline constexpr auto member_name_table = make_member_names<T>(std::make_index_sequence<field_count<T>()> {});
+	}	 // namespace details
+
+	/// \returns the amount of fields of the aggregate (up to 32).
+	template <details::IsReflectableAggregate T>
+	consteval auto member_count() -> size_t
+	{
+		static_assert(details::field_count<T>() <= details::max_member_count,
+					  "strtype: aggregates with more than 32 members are not supported");
+		return details::field_count<T>();
+	}
+
+	/// \brief Compile time names of the fields of an aggregate, in declaration order.
+	/// \details The names are stored back to back in a single table. Aggregates can have up to 32 fields, and can't
+	/// have base classes, bit-fields, reference fields, or C array fields.
+	/// \returns an `std::array<std::string_view>`, with an entry for every field.
+	template <details::IsReflectableAggregate T>
+	consteval auto member_names()
+	{
+		static_assert(details::field_count<T>() <= details::max_member_count,
+					  "strtype: aggregates with more than 32 members are not supported");
+		constexpr const auto& names = details::member_name_table<T>;
+		std::array<std::string_view, names.size()> result {};
+		for(size_t i = 0; i < names.size(); ++i) result[i] = names[i];
+		return result;
+	}
+
+	/// \brief Invokes the callback with the name and a reference to every field of the aggregate, in declaration order.
+	/// \details The fields are bound through a structured binding, and the names are compile time constants, so this
+	/// compiles down to the same code as a handwritten visitor.
+	template <typename T, typename Callback>
+		requires(details::IsReflectableAggregate<std::remove_cvref_t<T>>)
+	constexpr auto for_each_member(T&& obj, Callback&& callback) -> void
+	{
+		using type = std::remove_cvref_t<T>;
+		static_assert(details::field_count<type>() <= details::max_member_count,
+					  "strtype: aggregates with more than 32 members are not supported");
+		details::visit_fields<details::field_count<type>()>(obj, [&callback](auto&... fields) {
+			size_t index {0};
+			(callback(details::member_name_table<type>[index++], fields), ...);
+		});
+	}
+}	 // namespace strtype
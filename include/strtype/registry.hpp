@@ -0,0 +1,207 @@
+#pragma once
+#include "strtype/map.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#if !defined(STRTYPE_REGISTRY_CAPACITY)
+	#define STRTYPE_REGISTRY_CAPACITY 4096
+#endif
+
+namespace strtype
+{
+	/// \brief Runtime description of a type, see `strtype::register_type`.
+	/// \details All members point into statically stored compile time tables, so records can be shared between shared
+	/// objects for as long as the shared object that registered them is loaded.
+	struct type_record
+	{
+		std::string_view name {};	 // as given by `strtype::stringify_typename<T>()`
+		std::uint32_t hash {0};
+		std::span<const std::string_view> names {};	   // same order as `strtype::stringify<T>()`, empty for non-enums
+		std::span<const std::int64_t> values {};	   // the underlying values of `names`, sign extended
+		auto (*find_ordinal_by_value)(std::int64_t) noexcept -> size_t {nullptr};
+		auto (*find_ordinal_by_name)(std::string_view) noexcept -> size_t {nullptr};
+
+		constexpr auto is_enum() const noexcept -> bool { return find_ordinal_by_value != nullptr; }
+
+		/// \returns the name of the value, or an empty string when the value isn't present.
+		constexpr auto name_of(std::int64_t value) const noexcept -> std::string_view
+		{
+			if(!is_enum()) return {};
+			const auto ordinal = find_ordinal_by_value(value);
+			return ordinal < names.size() ? names[ordinal] : std::string_view {};
+		}
+
+		/// \returns a pointer to the value of the given name, or a nullptr when the name isn't present.
+		constexpr auto value_of(std::string_view name) const noexcept -> const std::int64_t*
+		{
+			if(!is_enum()) return nullptr;
+			const auto ordinal = find_ordinal_by_name(name);
+			return ordinal < values.size() ? &values[ordinal] : nullptr;
+		}
+	};
+
+	namespace details
+	{
+		template <typename T>
+		inline constexpr auto registry_names = stringify<T>();
+
+		template <typename T>
+		inline constexpr auto registry_values = []() consteval {
+			std::array<std::int64_t, stringify_map_v<T>.size()> result {};
+			for(size_t i = 0; i < result.size(); ++i)
+			{
+				result[i] = static_cast<std::int64_t>(to_underlying(stringify_map_v<T>.value_at_index(i)));
+			}
+			return result;
+		}();
+
+		template <typename T>
+		auto registry_find_by_value(std::int64_t value) noexcept -> size_t
+		{
+			using underlying_t = std::underlying_type_t<T>;
+			// values outside of the range of the underlying type can't be present
+			if(static_cast<std::int64_t>(static_cast<underlying_t>(value)) != value) return stringify_map_v<T>.size();
+			return stringify_map_v<T>.find_index(static_cast<T>(static_cast<underlying_t>(value)));
+		}
+
+		template <typename T>
+		auto registry_find_by_name(std::string_view name) noexcept -> size_t
+		{
+			return stringify_map_v<T>.find_index(name);
+		}
+
+		template <typename T>
+		consteval auto make_type_record() -> type_record
+		{
+			const std::string_view name = typename_storage<T>;
+			type_record result {name, fnv1a_32(name)};
+			if constexpr(HasEnumTable<T>)
+			{
+				result.names				 = registry_names<T>;
+				result.values				 = registry_values<T>;
+				result.find_ordinal_by_value = &registry_find_by_value<T>;
+				result.find_ordinal_by_name	 = &registry_find_by_name<T>;
+			}
+			return result;
+		}
+
+		template <typename T>
+		inline constexpr type_record type_record_v = make_type_record<T>();
+	}	 // namespace details
+
+	/// \brief Append only, open addressed table of `strtype::type_record`'s keyed on the typename.
+	/// \details Inserting is lock-free (a compare and swap on the slot), and looking up is wait-free as records are
+	/// never removed; a lookup probes at most `Capacity` slots and stops at the first empty one.
+	/// \tparam Capacity maximum amount of records, has to be a power of 2
+	template <size_t Capacity>
+	struct basic_registry
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "the capacity should be a power of 2");
+
+	  public:
+		constexpr basic_registry() = default;
+		basic_registry(const basic_registry&)			 = delete;
+		basic_registry& operator=(const basic_registry&) = delete;
+
+		/// \brief Stores the address of the record, so it has to outlive the registry (e.g. `details::type_record_v`).
+		/// \returns the record stored in the registry, which is the one that was registered first when another record
+		/// with the same typename is already present, or a nullptr when the registry is full.
+		auto insert(const type_record& record) noexcept -> const type_record*
+		{
+			for(size_t i = 0; i < Capacity; ++i)
+			{
+				auto& slot	  = m_Slots[(record.hash + i) & (Capacity - 1)];
+				auto expected = slot.load(std::memory_order_acquire);
+				if(expected == nullptr)
+				{
+					if(slot.compare_exchange_strong(
+						 expected, &record, std::memory_order_acq_rel, std::memory_order_acquire))
+					{
+						m_Size.fetch_add(1, std::memory_order_relaxed);
+						return &record;
+					}
+					// another thread claimed the slot first, `expected` now holds its record
+				}
+				if(expected->hash == record.hash && expected->name == record.name) return expected;
+			}
+			return nullptr;
+		}
+
+		// a temporary would leave a dangling pointer in the table
+		auto insert(type_record&& record) -> const type_record* = delete;
+
+		/// \returns the record of the given typename, or a nullptr when it isn't registered.
+		auto find(std::string_view name) const noexcept -> const type_record*
+		{
+			const auto hash = details::fnv1a_32(name);
+			for(size_t i = 0; i < Capacity; ++i)
+			{
+				const auto* record = m_Slots[(hash + i) & (Capacity - 1)].load(std::memory_order_acquire);
+				if(record == nullptr) return nullptr;
+				if(record->hash == hash && record->name == name) return record;
+			}
+			return nullptr;
+		}
+
+		auto size() const noexcept -> size_t { return m_Size.load(std::memory_order_relaxed); }
+		constexpr auto capacity() const noexcept -> size_t { return Capacity; }
+
+	  private:
+		std::atomic<const type_record*> m_Slots[Capacity] {};
+		std::atomic<size_t> m_Size {0};
+	};
+
+	using registry = basic_registry<STRTYPE_REGISTRY_CAPACITY>;
+
+#if defined(STRTYPE_REGISTRY_API)
+	/// \brief The process wide registry.
+	/// \details When `STRTYPE_REGISTRY_API` is defined (for example to your dllimport/dllexport macro), the registry is
+	/// expected to be defined in exactly one shared object, by including this header with
+	/// `STRTYPE_REGISTRY_IMPLEMENTATION` defined.
+	STRTYPE_REGISTRY_API auto global_registry() noexcept -> registry&;
+	#if defined(STRTYPE_REGISTRY_IMPLEMENTATION)
+	auto global_registry() noexcept -> registry&
+	{
+		static constinit registry instance {};
+		return instance;
+	}
+	#endif
+#else
+	/// \brief The process wide registry.
+	/// \details As an inline function with a static local, the ELF toolchains merge this into a single instance for all
+	/// shared objects that export it (the default visibility). For hidden visibility, or Windows DLLs, define
+	/// `STRTYPE_REGISTRY_API` instead.
+	inline auto global_registry() noexcept -> registry&
+	{
+		// constant initialized, so there's no guard (or lock) involved in the first call
+		static constinit registry instance {};
+		return instance;
+	}
+#endif
+
+	/// \brief Registers the type in the global registry, the typename (and for enums the names and values) become
+	/// available to all threads through `strtype::find_type`.
+	/// \returns the registered record, or a nullptr when the registry is full.
+	template <typename T>
+	auto register_type() noexcept -> const type_record*
+	{
+		return global_registry().insert(details::type_record_v<T>);
+	}
+
+	/// \returns the record of the given typename, or a nullptr when it isn't registered.
+	inline auto find_type(std::string_view name) noexcept -> const type_record*
+	{
+		return global_registry().find(name);
+	}
+
+	/// \brief Registers all given types on construction, meant to be used as a namespace scope static so the types are
+	/// registered during static initialization: `static const strtype::registrar<foo, bar> registered {};`
+	template <typename... Ts>
+	struct registrar
+	{
+		registrar() noexcept { (register_type<Ts>(), ...); }
+	};
+}	 // namespace strtype
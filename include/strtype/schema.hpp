@@ -0,0 +1,314 @@
+#pragma once
+#include "strtype/map.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+/// The schema is a compact binary description of the compile time tables, meant to be written once and decoded
+/// offline. Every field is stored little-endian, and the layout is as follows:
+///
+///   header: char[4] "STRT", u32 version, u32 type count
+///   type:   u32 name size, char[] name,
+///           u8 sizeof(underlying type) (0 when not an enum), u8 is signed, u16 reserved,
+///           u32 entry count, entry[] entries,
+///           u32 names size, char[] names
+///   entry:  u64 underlying value (sign extended), u32 name offset (into the type's names), u32 name size
+///
+/// Entries are stored in the same order as `strtype::stringify<T>()`, so the index of an entry is the ordinal returned
+/// by `strtype::enum_ordinal(value)`. As the entries are fixed size the decoder can find any ordinal in constant time,
+/// and all names are returned as views into the schema buffer.
+namespace strtype
+{
+	namespace details
+	{
+#pragma region schema_writer
+		inline constexpr std::string_view schema_magic {"STRT"};
+		inline constexpr std::uint32_t schema_version {1};
+		inline constexpr size_t schema_entry_size {16};
+
+		// when `out` is a nullptr only the offset is advanced, this allows for a sizing pass before writing.
+		constexpr auto schema_write(char* out, size_t& offset, std::uint64_t value, size_t bytes) -> void
+		{
+			for(size_t i = 0; i < bytes; ++i, ++offset)
+			{
+				if(out) out[offset] = static_cast<char>((value >> (i * 8)) & 255);
+			}
+		}
+
+		constexpr auto schema_write(char* out, size_t& offset, std::string_view value) -> void
+		{
+			for(size_t i = 0; i < value.size(); ++i, ++offset)
+			{
+				if(out) out[offset] = value[i];
+			}
+		}
+
+		template <typename T>
+		constexpr auto schema_write_type(char* out, size_t& offset) -> void
+		{
+			constexpr auto name = stringify_typename<T>();
+			schema_write(out, offset, name.size(), 4);
+			schema_write(out, offset, std::string_view {name});
+			if constexpr(HasEnumTable<T>)
+			{
+				using underlying_t = std::underlying_type_t<T>;
+				constexpr auto map = stringify_map<T>();
+				schema_write(out, offset, sizeof(underlying_t), 1);
+				schema_write(out, offset, std::is_signed_v<underlying_t> ? 1 : 0, 1);
+				schema_write(out, offset, 0, 2);
+				schema_write(out, offset, map.size(), 4);
+
+				size_t names_size {0};
+				for(const auto& [str, value] : map)
+				{
+					schema_write(out, offset, static_cast<std::uint64_t>(to_underlying(value)), 8);
+					schema_write(out, offset, names_size, 4);
+					schema_write(out, offset, str.size(), 4);
+					names_size += str.size();
+				}
+				schema_write(out, offset, names_size, 4);
+				for(const auto& [str, value] : map) schema_write(out, offset, str);
+			}
+			else
+			{
+				schema_write(out, offset, 0, 4);	// underlying size, is signed, and reserved
+				schema_write(out, offset, 0, 4);	// entry count
+				schema_write(out, offset, 0, 4);	// names size
+			}
+		}
+
+		template <typename... Ts>
+		constexpr auto schema_write_all(char* out = nullptr) -> size_t
+		{
+			size_t offset {0};
+			schema_write(out, offset, schema_magic);
+			schema_write(out, offset, schema_version, 4);
+			schema_write(out, offset, sizeof...(Ts), 4);
+			(schema_write_type<Ts>(out, offset), ...);
+			return offset;
+		}
+
+		template <typename... Ts>
+		inline constexpr auto schema_blob = []() constexpr {
+			std::array<char, schema_write_all<Ts...>()> result {};
+			schema_write_all<Ts...>(result.data());
+			return result;
+		}();
+
+		constexpr auto schema_read(const char* data, size_t bytes) -> std::uint64_t
+		{
+			std::uint64_t result {0};
+			for(size_t i = 0; i < bytes; ++i)
+			{
+				result |= std::uint64_t {static_cast<std::uint8_t>(data[i])} << (i * 8);
+			}
+			return result;
+		}
+#pragma endregion schema_writer
+	}	 // namespace details
+
+	/// \brief The schema of the given types, as a statically stored byte array.
+	/// \details Types that have a searchable enum range (see `strtype::enum_information`) will have their names and
+	/// values written out, other types only write their typename.
+	template <typename... Ts>
+	consteval auto schema() -> std::string_view
+	{
+		return std::string_view {details::schema_blob<Ts...>.data(), details::schema_blob<Ts...>.size()};
+	}
+
+	/// \brief Writes the schema of the given types to the output iterator.
+	/// \returns the output iterator one past the last written byte.
+	template <typename... Ts, typename OutputIt>
+	constexpr auto export_schema(OutputIt out) -> OutputIt
+	{
+		constexpr auto blob = schema<Ts...>();
+		return std::copy(std::begin(blob), std::end(blob), out);
+	}
+
+	/// \brief Non-owning view over a single type in a schema, all returned names point into the schema buffer.
+	struct schema_type_view
+	{
+	  public:
+		constexpr schema_type_view() = default;
+		constexpr explicit schema_type_view(const char* data) : m_Data(data)
+		{
+			auto name_size = details::schema_read(m_Data, 4);
+			m_Size		   = details::schema_read(m_Data + 8 + name_size, 4);
+			m_Entries	   = m_Data + 12 + name_size;
+			m_Names		   = m_Entries + (m_Size * details::schema_entry_size) + 4;
+		}
+
+		constexpr auto name() const -> std::string_view
+		{
+			return std::string_view {m_Data + 4, details::schema_read(m_Data, 4)};
+		}
+
+		/// \returns the size of the underlying type in bytes, or 0 when the type is not an enum.
+		constexpr auto underlying_size() const -> size_t { return details::schema_read(m_Data + 4 + name().size(), 1); }
+		constexpr auto is_signed() const -> bool { return details::schema_read(m_Data + 5 + name().size(), 1) != 0; }
+
+		constexpr auto size() const noexcept -> size_t { return m_Size; }
+		constexpr auto empty() const noexcept -> bool { return size() == 0; }
+
+		/// \returns the value at the given ordinal, unsigned values that do not fit in an `std::int64_t` wrap around.
+		constexpr auto value_at(size_t ordinal) const -> std::int64_t
+		{
+			return static_cast<std::int64_t>(details::schema_read(entry(ordinal), 8));
+		}
+
+		constexpr auto name_at(size_t ordinal) const -> std::string_view
+		{
+			const auto* it = entry(ordinal);
+			return std::string_view {m_Names + details::schema_read(it + 8, 4), details::schema_read(it + 12, 4)};
+		}
+
+		/// \returns the ordinal of the given value, the entries are sorted by value so this is a binary search.
+		constexpr auto ordinal_of(std::int64_t value) const -> size_t
+		{
+			const bool is_signed_type = is_signed();
+			constexpr auto less		  = [](std::int64_t lhs, std::int64_t rhs, bool is_signed_type) {
+				  return is_signed_type ? lhs < rhs : static_cast<std::uint64_t>(lhs) < static_cast<std::uint64_t>(rhs);
+			};
+
+			size_t first {0};
+			size_t count {m_Size};
+			while(count > 0)
+			{
+				auto step = count / 2;
+				if(less(value_at(first + step), value, is_signed_type))
+				{
+					first += step + 1;
+					count -= step + 1;
+				}
+				else
+				{
+					count = step;
+				}
+			}
+			if(first < m_Size && value_at(first) == value) return first;
+			throw std::exception(/* missing value */);
+		}
+
+		/// \returns the total size in bytes this type occupies in the schema.
+		constexpr auto byte_size() const -> size_t
+		{
+			return static_cast<size_t>(m_Names - m_Data) + details::schema_read(m_Names - 4, 4);
+		}
+
+	  private:
+		constexpr auto entry(size_t ordinal) const -> const char*
+		{
+			if(ordinal >= m_Size) throw std::exception(/* out of range */);
+			return m_Entries + ordinal * details::schema_entry_size;
+		}
+
+		const char* m_Data {nullptr};
+		const char* m_Entries {nullptr};
+		const char* m_Names {nullptr};
+		size_t m_Size {0};
+	};
+
+	/// \brief Non-owning view over a schema written by `strtype::export_schema`.
+	/// \details The buffer is validated on construction (throwing on malformed input), after which every access is a
+	/// direct read from the buffer. This makes it suitable for reading memory mapped files without copying.
+	struct schema_view
+	{
+	  public:
+		struct iterator
+		{
+			using iterator_category = std::forward_iterator_tag;
+			using value_type		= schema_type_view;
+			using difference_type	= std::ptrdiff_t;
+
+			constexpr auto operator*() const -> schema_type_view { return schema_type_view {m_Data}; }
+			constexpr auto operator++() -> iterator&
+			{
+				m_Data += schema_type_view {m_Data}.byte_size();
+				++m_Index;
+				return *this;
+			}
+			constexpr auto operator++(int) -> iterator
+			{
+				auto copy = *this;
+				++(*this);
+				return copy;
+			}
+			constexpr auto operator==(const iterator& other) const noexcept -> bool { return m_Index == other.m_Index; }
+
+			const char* m_Data {nullptr};
+			size_t m_Index {0};
+		};
+
+		constexpr explicit schema_view(std::string_view buffer) : m_Buffer(buffer)
+		{
+			constexpr size_t header_size = details::schema_magic.size() + 8;
+			if(m_Buffer.size() < header_size ||
+			   m_Buffer.substr(0, details::schema_magic.size()) != details::schema_magic ||
+			   details::schema_read(m_Buffer.data() + 4, 4) != details::schema_version)
+			{
+				throw std::exception(/* not a schema, or an unsupported version */);
+			}
+			m_Size = details::schema_read(m_Buffer.data() + 8, 4);
+
+			// walk every type, guaranteeing all reads done by the views stay inside of the buffer.
+			size_t offset {header_size};
+			const auto read = [this, &offset](size_t bytes) {
+				if(m_Buffer.size() - offset < bytes) throw std::exception(/* truncated schema */);
+				auto result = details::schema_read(m_Buffer.data() + offset, bytes);
+				offset += bytes;
+				return result;
+			};
+			const auto skip = [this, &offset](std::uint64_t bytes) {
+				if(m_Buffer.size() - offset < bytes) throw std::exception(/* truncated schema */);
+				offset += bytes;
+			};
+
+			for(size_t i = 0; i < m_Size; ++i)
+			{
+				skip(read(4));
+				read(4);
+				auto count		   = read(4);
+				auto entries_begin = offset;
+				if(count > (m_Buffer.size() - offset) / details::schema_entry_size)
+					throw std::exception(/* truncated schema */);
+				skip(count * details::schema_entry_size);
+				auto names_size = read(4);
+				skip(names_size);
+				for(size_t entry = 0; entry < count; ++entry)
+				{
+					const auto* it = m_Buffer.data() + entries_begin + entry * details::schema_entry_size;
+					auto name_offset = details::schema_read(it + 8, 4);
+					auto name_size	 = details::schema_read(it + 12, 4);
+					if(name_offset > names_size || name_size > names_size - name_offset)
+						throw std::exception(/* name outside of the names block */);
+				}
+			}
+		}
+
+		/// \returns the amount of types in the schema.
+		constexpr auto size() const noexcept -> size_t { return m_Size; }
+		constexpr auto begin() const noexcept -> iterator
+		{
+			return iterator {m_Buffer.data() + details::schema_magic.size() + 8, 0};
+		}
+		constexpr auto end() const noexcept -> iterator { return iterator {nullptr, m_Size}; }
+
+		/// \returns the iterator to the type with the given name (as given by `strtype::stringify_typename<T>()`), or
+		/// `end()` when not present.
+		constexpr auto find(std::string_view type_name) const -> iterator
+		{
+			for(auto it = begin(); it != end(); ++it)
+			{
+				if((*it).name() == type_name) return it;
+			}
+			return end();
+		}
+
+	  private:
+		std::string_view m_Buffer {};
+		size_t m_Size {0};
+	};
+}	 // namespace strtype
@@ -0,0 +1,681 @@
+#pragma once
+#include "strtype/core.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if !defined(STRTYPE_MAX_SEARCH_SIZE)
+	#define STRTYPE_MAX_SEARCH_SIZE 1024
+#endif
+
+namespace strtype
+{
+	namespace details
+	{
+#pragma region helpers
+		template <typename T>
+		concept EnumHasKnownBegin = requires() { T::_BEGIN; };
+
+		template <typename T>
+		concept EnumHasKnownEnd = requires() { T::_END; };
+
+		template <EnumHasKnownBegin T>
+		consteval auto enum_start() -> std::underlying_type_t<T>
+		{
+			return to_underlying(T::_BEGIN);
+		}
+
+		template <EnumHasKnownEnd T>
+		consteval auto enum_end() -> std::underlying_type_t<T>
+		{
+			return to_underlying(T::_END) + 1;
+		}
+
+		template <typename T>
+		struct enum_start_t
+		{};
+
+		template <EnumHasKnownBegin T>
+		struct enum_start_t<T>
+		{
+			static constexpr auto BEGIN = details::enum_start<T>();
+		};
+
+		template <typename T>
+		struct enum_end_t
+		{};
+
+		template <EnumHasKnownEnd T>
+		struct enum_end_t<T>
+		{
+			static constexpr auto END = details::enum_end<T>();
+		};
+
+		// figure out if the Value is either an enum value of the given enum type, or equivalent to the underlying
+		// value;
+		template <typename T, auto Value>
+		concept IsEnumValueOrUnderlying = IsValidStringifyableEnum<T> &&
+										  (std::is_same_v<decltype(Value), T> ||
+										   std::is_same_v<decltype(Value), std::underlying_type_t<T>>);
+
+		template <typename T, auto Value, bool ApplyOffset = false>
+			requires(IsEnumValueOrUnderlying<T, Value>)
+		consteval auto guarantee_is_underlying_value() -> std::underlying_type_t<T>
+		{
+			if constexpr(std::is_same_v<T, decltype(Value)>)
+				return to_underlying(Value) + std::underlying_type_t<T>(ApplyOffset ? 1 : 0);
+			else
+				return Value;
+		}
+
+		template <auto Offset, typename T, auto... Indices>
+		consteval auto make_offset_sequence_impl(std::integer_sequence<T, Indices...>)
+		{
+			return std::integer_sequence<T, Indices + Offset...> {};
+		}
+
+		template <auto Offset, auto Size, typename T = decltype(Offset)>
+		consteval auto make_offset_sequence()
+		{
+			return make_offset_sequence_impl<Offset>(std::make_integer_sequence<T, Size>());
+		}
+
+		enum class dummy
+		{
+		};
+
+		template <typename Y, typename T>
+		struct is_array_of_type : std::false_type
+		{};
+
+		template <typename T, size_t S>
+		struct is_array_of_type<T, std::array<T, S>> : std::true_type
+		{};
+
+		template <typename EnumType, typename T>
+		struct is_required_return_type : std::false_type
+		{};
+
+		template <typename EnumType, typename T, typename Y>
+			requires(is_array_of_type<std::string_view, T>::value && is_array_of_type<EnumType, Y>::value)
+		struct is_required_return_type<EnumType, std::pair<T, Y>> : std::true_type
+		{};
+
+		template <typename EnumType, typename T>
+		concept IsRequiredReturnType = is_required_return_type<EnumType, T>::value;
+
+#pragma endregion helpers
+	}	 // namespace details
+
+	struct sequential_searcher;
+
+	template <size_t WindowSize, size_t EmptyWindows, bool ProbeBits, size_t MinimumRange>
+	struct basic_auto_searcher;
+
+	/// \brief the default searcher for enums without a known range, see `strtype::basic_auto_searcher`. Both sides
+	/// always cover at least the 8 bit range.
+	using auto_searcher = basic_auto_searcher<16, 2, true, 256>;
+
+	/// \brief Customization point for enum types
+	/// \details Here you can add a customization for your specific enum type, set its `BEGIN` and `END`, as well as
+	/// custom searcher, or search depth overrides. When the enum has neither a `_BEGIN` and `_END`, nor a
+	/// specialization, the values are found by `strtype::auto_searcher`.
+	/// \tparam T A valid stringifyable enum type (a scoped enum that satisfies std::is_integral)
+	template <details::IsValidStringifyableEnum T>
+	struct enum_information : public details::enum_start_t<T>, details::enum_end_t<T>
+	{
+		using SEARCHER = std::conditional_t<details::EnumHasKnownBegin<T> && details::EnumHasKnownEnd<T>,
+											sequential_searcher,
+											auto_searcher>;
+	};
+
+	namespace details
+	{
+		template <typename T>
+		concept HasBeginInformation = requires() { enum_information<T>::BEGIN; };
+
+		template <typename T>
+		concept HasEndInformation = requires() { enum_information<T>::END; };
+
+		// the default range when the enum_information lacks one is the whole underlying type, where the maximum is
+		// excluded as `End` is exclusive for underlying values.
+		template <typename T>
+		consteval auto search_begin()
+		{
+			if constexpr(HasBeginInformation<T>)
+				return enum_information<T>::BEGIN;
+			else
+				return std::numeric_limits<std::underlying_type_t<T>>::min();
+		}
+
+		template <typename T>
+		consteval auto search_end()
+		{
+			if constexpr(HasEndInformation<T>)
+				return enum_information<T>::END;
+			else
+				return std::numeric_limits<std::underlying_type_t<T>>::max();
+		}
+
+		template <typename T>
+		concept HasMaxSearchSizeOverride = requires() { enum_information<T>::MAX_SEARCH_SIZE; };
+
+		template <typename T>
+		consteval auto max_search_size() -> size_t
+		{
+			if constexpr(HasMaxSearchSizeOverride<T>)
+			{
+				return enum_information<T>::MAX_SEARCH_SIZE;
+			}
+			else
+			{
+				return STRTYPE_MAX_SEARCH_SIZE;
+			}
+		}
+
+		// the amount of values in [From, To), computed unsigned so it can't overflow for signed types
+		template <typename U>
+		consteval auto search_distance(U from, U to) -> std::uint64_t
+		{
+			return static_cast<std::uint64_t>(to) - static_cast<std::uint64_t>(from);
+		}
+
+		template <typename... Ts>
+		struct get_array_pack_size
+		{};
+
+		template <typename T, size_t S, typename... Res>
+		struct get_array_pack_size<std::array<T, S>, Res...>
+		{
+			static constexpr auto value = []() {
+				if constexpr(sizeof...(Res) > 0)
+				{
+					return S + get_array_pack_size<Res...>::value;
+				}
+				else
+				{
+					return S;
+				}
+			}();
+		};
+
+		template <typename T, typename Y, typename... Res>
+		struct get_array_pack_size<std::pair<T, Y>, Res...> : get_array_pack_size<T, Res...>
+		{};
+
+		/// \brief concatenates the results of searchers (or `strtype::stringify(std::integer_sequence)`) in the given
+		/// order.
+		template <typename T, typename... Ts>
+		consteval auto merge_search_results(const Ts&... results)
+		{
+			constexpr auto total_size = get_array_pack_size<Ts...>::value;
+			std::array<std::string_view, total_size> res_string {};
+			std::array<T, total_size> res_values {};
+			size_t offset {0};
+			constexpr auto fill = [](auto& dst_str, auto& dst_values, const auto& src, size_t& offset) constexpr {
+				for(size_t i = 0; i < src.first.size(); ++offset, ++i)
+				{
+					dst_str[offset]	   = src.first[i];
+					dst_values[offset] = src.second[i];
+				}
+			};
+			(fill(res_string, res_values, results, offset), ...);
+			return std::pair {res_string, res_values};
+		}
+
+		template <typename T>
+		consteval auto empty_search_result()
+		{
+			return std::pair {std::array<std::string_view, 0> {}, std::array<T, 0> {}};
+		}
+	}	 // namespace details
+
+	/// \brief iterates over the indices, and fills in the values as needed.
+	/// \returns an std::pair<std::array<std::string_view>, std::array<T>>. The arrays are 1-1 mapped (i.e. the indices point to the same enum value, just different representation)
+	/// \note this function is solely provided to make implementing custom *_searcher types easier.
+	template <typename T, typename sequence_type, auto... Indices>
+	constexpr auto stringify(std::integer_sequence<sequence_type, Indices...>)
+	{
+		constexpr auto get_and_fill_valid_enum_values = [](std::string_view* str_buffer = nullptr,
+														   T* value_buffer				= nullptr) constexpr {
+			size_t count = 0;
+
+			constexpr auto get_and_fill_valid_enum_value =
+			  []<auto Index>(auto& count, std::string_view* str_buffer, T* value_buffer) constexpr
+			{
+				// with a known begin the offset of the name is the same for every value, otherwise each value is
+				// scanned
+				constexpr auto get_enum_name = []<T value>() constexpr {
+					if constexpr(details::HasBeginInformation<T>)
+						return details::stringify_value_impl<
+						  value,
+						  details::get_known_offset<T {enum_information<T>::BEGIN}>()>();
+					else
+						return details::stringify_value_impl<value, details::get_value_offset<value>()>();
+				};
+
+				constexpr auto enum_value {T {static_cast<std::underlying_type_t<T>>(Index)}};
+				constexpr auto name = get_enum_name.template operator()<enum_value>();
+				if(!name.empty())
+				{
+					if(str_buffer)
+					{
+						value_buffer[count] = enum_value;
+						// workaround for MSVC related ICE
+						// todo report the ICE, and verify for fix later
+						[]<details::fixed_string Str>(size_t index, auto& str_buffer) constexpr {
+							str_buffer[index] = Str;
+						}.template operator()<name>(count, str_buffer);
+					}
+					++count;
+				}
+			};
+
+			(get_and_fill_valid_enum_value.template operator()<Indices>(count, str_buffer, value_buffer), ...);
+			return count;
+		};
+		constexpr auto size = get_and_fill_valid_enum_values();
+
+		std::array<std::string_view, size> str_result {};
+		std::array<T, size> val_result {};
+		get_and_fill_valid_enum_values(str_result.data(), val_result.data());
+		return std::pair {str_result, val_result};
+	}
+
+	/// \brief Sequentially searches from [Begin, End) for valid enum values
+	/// \note this can be quite compile time intensive O(max_size()). The range is searched in packs of at most 255
+	/// values to stay within CLang's limit on fold expression expansions, which are merged pairwise as a balanced tree.
+	struct sequential_searcher
+	{
+		template <typename T, auto Begin, auto End>
+		consteval auto max_size() -> size_t
+		{
+			return End - Begin;
+		}
+
+		template <typename T, auto Begin, auto End>
+		consteval auto candidates() -> size_t
+		{
+			return details::search_distance<std::underlying_type_t<T>>(Begin, End);
+		}
+
+		template <typename T, auto Begin, auto End>
+		consteval auto operator()() const noexcept
+		{
+			using underlying_t = std::underlying_type_t<T>;
+			constexpr auto size = details::search_distance<underlying_t>(Begin, End);
+			return search<T, static_cast<underlying_t>(Begin), static_cast<size_t>(size)>();
+		}
+
+	  private:
+		// CLang has a hard limit of 256 expansions for fold expressions, and packs also have to fit in the underlying
+		// type, so a single `stringify(std::integer_sequence)` searches at most this many values.
+		template <typename T>
+		static constexpr size_t PACK_SIZE = std::numeric_limits<std::underlying_type_t<T>>::max() < 255
+											  ? std::numeric_limits<std::underlying_type_t<T>>::max()
+											  : 255;
+
+		// searches [Begin, Begin + Size) by splitting it in two halves (on a multiple of the pack size) until a half
+		// fits in a single pack. Every fold expands at most `PACK_SIZE` values, and every merge is of 2 results, so the
+		// depth of the instantiations is only log2(Size / PACK_SIZE) regardless of the size of the range.
+		template <typename T, std::underlying_type_t<T> Begin, size_t Size>
+		static consteval auto search()
+		{
+			using underlying_t = std::underlying_type_t<T>;
+			if constexpr(Size <= PACK_SIZE<T>)
+			{
+				constexpr auto count = static_cast<underlying_t>(Size);
+				return stringify<T>(details::make_offset_sequence<Begin, count, underlying_t>());
+			}
+			else
+			{
+				constexpr size_t packs	 = (Size + PACK_SIZE<T> - 1) / PACK_SIZE<T>;
+				constexpr size_t half	 = (packs / 2) * PACK_SIZE<T>;
+				constexpr auto mid_point = static_cast<underlying_t>(static_cast<std::uint64_t>(Begin) + half);
+				return details::merge_search_results<T>(search<T, Begin, half>(), search<T, mid_point, Size - half>());
+			}
+		}
+	};
+
+	/// \brief searcher specialized for enums that are used as bitflags.
+	/// \note does not include combinatorial values (like 0x3, which would be bit flag 1 && 2). If that's needed, consider `strtype::sequential_searcher`
+	struct bitflag_searcher
+	{
+		template <typename T, auto Begin, auto End>
+		consteval auto max_size() -> size_t
+		{
+			return (sizeof(std::underlying_type_t<T>) * 8) + 1;
+		}
+
+		template <typename T, auto Begin, auto End>
+		consteval auto candidates() -> size_t
+		{
+			return max_size<T, Begin, End>();
+		}
+
+		template <typename T, auto Begin, auto End>
+		consteval auto operator()() const noexcept
+		{
+			using underlying_t	= std::underlying_type_t<T>;
+			constexpr auto BITS = sizeof(underlying_t) * 8;
+			static_assert(BITS <= sizeof(size_t) * 8, "No support for larger than `sizeof(size_t)` bytes");
+
+			// prepares an std::index_sequence<> where the indices are every bit value with added 0. I.e. it's a range
+			// that looks like: { 0, 1, 2, 4, 8, 16, 32, ..., 1 << (sizeof(underlying_t) * 8) }
+			constexpr auto bit_shift_indices = []<size_t... Indices>(std::index_sequence<Indices...>) constexpr
+			{
+				return std::index_sequence<0, size_t {1} << Indices...> {};
+			}
+			(std::make_index_sequence<BITS>());
+
+			return stringify<T>(bit_shift_indices);
+		}
+	};
+
+	namespace details
+	{
+#pragma region auto_searcher
+		consteval auto search_min(std::uint64_t lhs, std::uint64_t rhs) -> std::uint64_t
+		{
+			return lhs < rhs ? lhs : rhs;
+		}
+
+		template <typename T, auto From, auto To>
+		consteval auto search_window()
+		{
+			return sequential_searcher {}.template operator()<T, From, To>();
+		}
+
+		// the amount of empty windows in a row after this one, windows that end within the `Guarantee` values that are
+		// always searched don't count.
+		consteval auto count_empty(bool is_empty, size_t empty, size_t count, size_t guarantee) -> size_t
+		{
+			return !is_empty ? 0 : (count >= guarantee ? empty + 1 : empty);
+		}
+
+		consteval auto remaining_guarantee(size_t count, size_t guarantee) -> size_t
+		{
+			return guarantee > count ? guarantee - count : 0;
+		}
+
+		// searches [From, End) in windows that double in size, returns the result and the end of the searched region.
+		template <typename T,
+				  auto From,
+				  auto End,
+				  size_t Size,
+				  size_t Empty,
+				  size_t EmptyWindows,
+				  size_t Guarantee,
+				  size_t Budget>
+		consteval auto search_windows_up()
+		{
+			using underlying_t	   = std::underlying_type_t<T>;
+			constexpr auto remains = search_distance<underlying_t>(From, End);
+			constexpr size_t count = search_min(search_min(Size, Budget), remains);
+			constexpr auto to	   = static_cast<underlying_t>(static_cast<std::uint64_t>(From) + count);
+			constexpr auto window  = search_window<T, From, to>();
+			constexpr size_t empty = count_empty(window.first.size() == 0, Empty, count, Guarantee);
+			if constexpr(to == End || empty == EmptyWindows || count == Budget)
+			{
+				return std::pair {window, to};
+			}
+			else
+			{
+				constexpr auto next = search_windows_up<T,
+														to,
+														End,
+														Size * 2,
+														empty,
+														EmptyWindows,
+														remaining_guarantee(count, Guarantee),
+														Budget - count>();
+				return std::pair {merge_search_results<T>(window, next.first), next.second};
+			}
+		}
+
+		// searches [Begin, To) in windows that double in size starting at To, returns the result and the start of the
+		// searched region.
+		template <typename T,
+				  auto To,
+				  auto Begin,
+				  size_t Size,
+				  size_t Empty,
+				  size_t EmptyWindows,
+				  size_t Guarantee,
+				  size_t Budget>
+		consteval auto search_windows_down()
+		{
+			using underlying_t	   = std::underlying_type_t<T>;
+			constexpr auto remains = search_distance<underlying_t>(Begin, To);
+			constexpr size_t count = search_min(search_min(Size, Budget), remains);
+			constexpr auto from	   = static_cast<underlying_t>(static_cast<std::uint64_t>(To) - count);
+			constexpr auto window  = search_window<T, from, To>();
+			constexpr size_t empty = count_empty(window.first.size() == 0, Empty, count, Guarantee);
+			if constexpr(from == Begin || empty == EmptyWindows || count == Budget)
+			{
+				return std::pair {window, from};
+			}
+			else
+			{
+				constexpr auto next = search_windows_down<T,
+														  from,
+														  Begin,
+														  Size * 2,
+														  empty,
+														  EmptyWindows,
+														  remaining_guarantee(count, Guarantee),
+														  Budget - count>();
+				return std::pair {merge_search_results<T>(next.first, window), next.second};
+			}
+		}
+
+		template <typename T>
+		consteval auto search_bit_count() -> size_t
+		{
+			using underlying_t = std::underlying_type_t<T>;
+			return sizeof(underlying_t) * 8 - (std::is_signed_v<underlying_t> ? 1 : 0);
+		}
+
+		// the (positive) single bit values in [From, End), and their amount
+		template <typename T, auto From, auto End>
+		consteval auto search_bit_probes()
+		{
+			using underlying_t = std::underlying_type_t<T>;
+			std::array<underlying_t, search_bit_count<T>()> values {};
+			size_t count {0};
+			for(size_t i = 0; i < values.size(); ++i)
+			{
+				const auto value = static_cast<underlying_t>(std::uint64_t {1} << i);
+				if(value >= From && value < End) values[count++] = value;
+			}
+			return std::pair {values, count};
+		}
+
+		template <typename T, auto From, auto End>
+		consteval auto search_bits()
+		{
+			using underlying_t	  = std::underlying_type_t<T>;
+			constexpr auto probes = search_bit_probes<T, From, End>();
+			// no single bit value lies past the windows, an empty pack would only instantiate an empty `stringify`
+			if constexpr(probes.second == 0)
+			{
+				return empty_search_result<T>();
+			}
+			else
+			{
+				return stringify<T>([&probes]<size_t... Indices>(std::index_sequence<Indices...>) {
+					return std::integer_sequence<underlying_t, probes.first[Indices]...> {};
+				}(std::make_index_sequence<probes.second>()));
+			}
+		}
+#pragma endregion auto_searcher
+	}	 // namespace details
+
+	/// \brief Discovers the values of enums without a known range, searching outward from 0.
+	/// \details Both the positive side and (for signed types) the negative side start with a window of `WindowSize`
+	/// values, and every following window is twice the size of the previous one. A side always covers the first
+	/// `MinimumRange` values, and past those stops after `EmptyWindows` empty windows in a row, when it reaches
+	/// `Begin`/`End`, or when the search budget (`MAX_SEARCH_SIZE`, see `strtype::enum_information`) runs out. The
+	/// positive side is searched first, but the minimum range of the negative side is kept out of its budget.
+	/// Afterwards every single bit value past the searched region is probed, in the spirit of
+	/// `strtype::bitflag_searcher`. Any other value beyond the minimum range and `EmptyWindows` empty windows is
+	/// missed, e.g. 10000 of an `std::int16_t` enum whose other values are all close to 0. The compile cost is
+	/// proportional to the populated region instead of the range of the underlying type.
+	/// \tparam WindowSize size of the first window on either side
+	/// \tparam EmptyWindows amount of empty windows in a row after which a side stops searching
+	/// \tparam ProbeBits probe the single bit values past the searched region
+	/// \tparam MinimumRange amount of values on either side that is always searched, empty or not
+	template <size_t WindowSize, size_t EmptyWindows, bool ProbeBits, size_t MinimumRange>
+	struct basic_auto_searcher
+	{
+		static_assert(WindowSize > 0 && EmptyWindows > 0);
+
+		template <typename T, auto Begin, auto End>
+		consteval auto max_size() -> size_t
+		{
+			return details::max_search_size<T>();
+		}
+
+		/// \returns the amount of values that are instantiated by the search, see `strtype::enum_stats`.
+		template <typename T, auto Begin, auto End>
+		consteval auto candidates() -> size_t
+		{
+			return search<T, Begin, End>().second;
+		}
+
+		template <typename T, auto Begin, auto End>
+		consteval auto operator()() const noexcept
+		{
+			return search<T, Begin, End>().first;
+		}
+
+	  private:
+		// returns the result and the amount of candidates
+		template <typename T, auto Begin, auto End>
+		static consteval auto search()
+		{
+			using underlying_t = std::underlying_type_t<T>;
+			constexpr underlying_t zero {0};
+			constexpr underlying_t up_from = Begin > zero ? Begin : zero;
+			constexpr underlying_t down_to = End < zero ? End : zero;
+
+			// the bit probes are reserved up front, so they're never starved by the windows
+			constexpr size_t probes = ProbeBits ? details::search_bit_count<T>() : 0;
+			constexpr size_t budget =
+			  details::max_search_size<T>() > probes ? details::max_search_size<T>() - probes : 0;
+
+			// as is the minimum range of the negative side, so the positive side can't use it up
+			constexpr size_t down_range =
+			  Begin < down_to ? details::search_distance<underlying_t>(Begin, down_to) : 0;
+			constexpr size_t down_minimum = details::search_min(MinimumRange, down_range);
+			constexpr size_t up_budget	  = budget > down_minimum ? budget - down_minimum : 0;
+
+			constexpr auto up = []() {
+				if constexpr(up_from < End && up_budget > 0)
+					return details::
+					  search_windows_up<T, up_from, End, WindowSize, 0, EmptyWindows, MinimumRange, up_budget>();
+				else
+					return std::pair {details::empty_search_result<T>(), static_cast<underlying_t>(up_from)};
+			}();
+			constexpr size_t up_size = details::search_distance<underlying_t>(up_from, up.second);
+
+			constexpr auto down = []() {
+				if constexpr(Begin < down_to && budget - up_size > 0)
+					return details::search_windows_down<T,
+														down_to,
+														Begin,
+														WindowSize,
+														0,
+														EmptyWindows,
+														MinimumRange,
+														budget - up_size>();
+				else
+					return std::pair {details::empty_search_result<T>(), static_cast<underlying_t>(down_to)};
+			}();
+			constexpr size_t down_size = details::search_distance<underlying_t>(down.second, down_to);
+
+			constexpr auto bits = []() {
+				if constexpr(ProbeBits)
+					return std::pair {details::search_bits<T, up.second, End>(),
+									  details::search_bit_probes<T, up.second, End>().second};
+				else
+					return std::pair {details::empty_search_result<T>(), size_t {0}};
+			}();
+
+			// every part covers a higher range than the previous, so the result is sorted.
+			return std::pair {details::merge_search_results<T>(down.first, up.first, bits.first),
+							  up_size + down_size + bits.second};
+		}
+	};
+
+	namespace details
+	{
+		template <size_t Size>
+		consteval auto max_name_length(const std::array<std::string_view, Size>& names) -> size_t
+		{
+			size_t result {0};
+			for(const auto& name : names) result = name.size() > result ? name.size() : result;
+			return result;
+		}
+
+		template <typename T, auto Begin, auto End, typename Searcher, bool OnlyStrings = true>
+		consteval auto get_unique_entries()
+		{
+			constexpr auto MAXSIZE = Searcher {}.template max_size<T, Begin, End>();
+			static_assert(
+			  MAXSIZE <= max_search_size<T>(),
+			  "Up the max search size for this enum. Either prefferably by specializing the 'enum_information<T>' and "
+			  "setting MAX_SEARCH_SIZE higher, or by upping the define (which would globally increase it)");
+
+			constexpr auto result = Searcher {}.template operator()<T, Begin, End>();
+			static_assert(IsRequiredReturnType<T, std::remove_cvref_t<decltype(result)>>,
+						  "the result type should be of `std::pair<std::array<std::string_view, SIZE>, std::array<T, "
+						  "SIZE>>` from the searcher.");
+
+			static_assert(result.first.size() <= MAXSIZE,
+						  "Expected the Searcher{}.max_size() to be larger or equal to the resulting size");
+			if constexpr(OnlyStrings)
+			{
+				return result.first;
+			}
+			else
+			{
+				return result;
+			}
+		}
+	}	 // namespace details
+
+	/// \brief Compile time stringify your enum type into an array from the range BEGIN to END
+	/// \tparam Searcher functional object that can iterate, and return the values (see `strtype::sequential_searcher` for example)
+	/// \tparam T enum type that satisfies the constraint
+	/// \tparam Begin start of the range (inclusive) to stringify, defaults to the minimum of the underlying type when
+	/// unknown
+	/// \tparam End end of the range (inclusive if decltype(End) == T, otherwise exclusive), defaults to the maximum of
+	/// the underlying type when unknown
+	/// \returns an `std::array<std::string_view>` containing the ordered (by std::underlying_type_t<T>) string based representation values of the enum.
+	template <details::IsValidStringifyableEnum T,
+			  auto Begin		= details::search_begin<T>(),
+			  auto End			= details::search_end<T>(),
+			  typename Searcher = typename enum_information<T>::SEARCHER>
+	consteval auto stringify()
+	{
+		constexpr auto begin = details::guarantee_is_underlying_value<T, Begin>();
+		constexpr auto end	 = details::guarantee_is_underlying_value<T, End, true>();
+		static_assert(begin < end, "The end value should be larger than begin");
+		return details::get_unique_entries<T, begin, end, Searcher>();
+	}
+
+	/// \returns the length of the longest name of the enum, for example to size fixed width output columns.
+	template <details::IsValidStringifyableEnum T,
+			  auto Begin		= details::search_begin<T>(),
+			  auto End			= details::search_end<T>(),
+			  typename Searcher = typename enum_information<T>::SEARCHER>
+	consteval auto max_name_length() -> size_t
+	{
+		return details::max_name_length(stringify<T, Begin, End, Searcher>());
+	}
+}	 // namespace strtype
@@ -0,0 +1,222 @@
+#pragma once
+#include "strtype/map.hpp"
+
+#include <array>
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+
+namespace strtype
+{
+	/// \brief Concept for name transforms, see `strtype::case_transform` for an example.
+	/// \details A transform writes the transformed name into `out` (when it isn't a nullptr) and returns its size. It
+	/// is invoked twice per name at compile time, once to size the storage and once to fill it.
+	template <typename T>
+	concept IsNameTransform = requires(std::string_view name, char* out) {
+		{ T::transform(name, out) } -> std::convertible_to<size_t>;
+	};
+
+	namespace details
+	{
+#pragma region words
+		constexpr auto is_lower(char c) noexcept -> bool { return c >= 'a' && c <= 'z'; }
+		constexpr auto is_upper(char c) noexcept -> bool { return c >= 'A' && c <= 'Z'; }
+		constexpr auto is_digit(char c) noexcept -> bool { return c >= '0' && c <= '9'; }
+		constexpr auto to_lower(char c) noexcept -> char { return is_upper(c) ? static_cast<char>(c - 'A' + 'a') : c; }
+		constexpr auto to_upper(char c) noexcept -> char { return is_lower(c) ? static_cast<char>(c - 'a' + 'A') : c; }
+
+		/// \brief splits the name into words, and invokes the callback for every word.
+		/// \details Words are separated by '_', '-', ' ' and '.', as well as by case changes. A case change is either a
+		/// lowercase letter or digit followed by an uppercase letter ("fooBar"), or the last uppercase letter of an
+		/// acronym that's followed by a lowercase letter ("HTTPServer" becomes "HTTP" and "Server").
+		constexpr auto for_each_word(std::string_view name, auto&& callback) -> void
+		{
+			constexpr auto is_separator = [](char c) { return c == '_' || c == '-' || c == ' ' || c == '.'; };
+			size_t begin {0};
+			while(begin < name.size())
+			{
+				if(is_separator(name[begin]))
+				{
+					++begin;
+					continue;
+				}
+
+				size_t end {begin + 1};
+				for(; end < name.size() && !is_separator(name[end]); ++end)
+				{
+					const auto previous = name[end - 1];
+					const auto current	= name[end];
+					if(is_upper(current) && (is_lower(previous) || is_digit(previous))) break;
+					if(is_upper(current) && is_upper(previous) && end + 1 < name.size() && is_lower(name[end + 1]))
+						break;
+				}
+				callback(name.substr(begin, end - begin));
+				begin = end;
+			}
+		}
+#pragma endregion words
+	}	 // namespace details
+
+	enum class word_case
+	{
+		lower,
+		upper,
+		capitalized,
+	};
+
+	/// \brief Splits a name into words (see `details::for_each_word`), and joins them together using the given casing
+	/// and separator.
+	/// \tparam First casing of the first word
+	/// \tparam Rest casing of every other word
+	/// \tparam Separator character placed in between the words, or '\0' when they should be concatenated.
+	template <word_case First, word_case Rest, char Separator>
+	struct case_transform
+	{
+		static constexpr auto transform(std::string_view name, char* out) -> size_t
+		{
+			size_t size {0};
+			bool first {true};
+			details::for_each_word(name, [&size, &first, out](std::string_view word) {
+				if(!first && Separator != '\0')
+				{
+					if(out) out[size] = Separator;
+					++size;
+				}
+
+				const auto casing = first ? First : Rest;
+				for(size_t i = 0; i < word.size(); ++i, ++size)
+				{
+					if(!out) continue;
+					if(casing == word_case::upper || (casing == word_case::capitalized && i == 0))
+						out[size] = details::to_upper(word[i]);
+					else
+						out[size] = details::to_lower(word[i]);
+				}
+				first = false;
+			});
+			return size;
+		}
+	};
+
+	using snake_case	   = case_transform<word_case::lower, word_case::lower, '_'>;
+	using upper_snake_case = case_transform<word_case::upper, word_case::upper, '_'>;
+	using kebab_case	   = case_transform<word_case::lower, word_case::lower, '-'>;
+	using camel_case	   = case_transform<word_case::lower, word_case::capitalized, '\0'>;
+	using pascal_case	   = case_transform<word_case::capitalized, word_case::capitalized, '\0'>;
+	using title_case	   = case_transform<word_case::capitalized, word_case::capitalized, ' '>;
+
+	/// \brief Surrounds every name with a prefix and suffix, optionally transforming the name itself first. This builds
+	/// per value keys at compile time, e.g.
+	/// `strtype::stringify<foo, strtype::affix<"net.", ".latency", snake_case>>()`.
+	/// \tparam Transform transform applied to the name in between the prefix and suffix, or `void` to keep it as is.
+	template <fixed_string Prefix, fixed_string Suffix = "", typename Transform = void>
+	struct affix
+	{
+		static constexpr auto transform(std::string_view name, char* out) -> size_t
+		{
+			size_t size {0};
+			const auto write = [&size, out](std::string_view str) {
+				for(size_t i = 0; i < str.size(); ++i, ++size)
+				{
+					if(out) out[size] = str[i];
+				}
+			};
+
+			write(Prefix);
+			if constexpr(std::is_void_v<Transform>)
+				write(name);
+			else
+				size += Transform::transform(name, out ? out + size : nullptr);
+			write(Suffix);
+			return size;
+		}
+	};
+
+	namespace details
+	{
+		template <IsNameTransform Transform, size_t Count>
+		consteval auto packed_transform_size(const std::array<std::string_view, Count>& names) -> size_t
+		{
+			size_t size {0};
+			for(const auto& name : names) size += Transform::transform(name, nullptr);
+			return size;
+		}
+
+		template <IsNameTransform Transform, size_t Count, size_t Bytes>
+		consteval auto make_packed_transform(const std::array<std::string_view, Count>& names)
+		{
+			packed_names<Count, Bytes> result {};
+			for(size_t i = 0; i < Count; ++i)
+			{
+				result.offsets[i + 1] =
+				  result.offsets[i] + Transform::transform(names[i], result.buffer.data() + result.offsets[i]);
+			}
+
+			for(size_t i = 0; i < Count; ++i)
+			{
+				for(size_t j = i + 1; j < Count; ++j)
+				{
+					if(result[i] == result[j]) throw std::exception(/* the transform made two names identical */);
+				}
+			}
+			return result;
+		}
+
+		// statically stored so that all returned `std::string_view`'s point into a single table.
+		template <typename T, IsNameTransform Transform, auto Begin, auto End, typename Searcher>
+		inline constexpr auto transformed_names = []() consteval {
+			constexpr auto names = strtype::stringify<T, Begin, End, Searcher>();
+			return make_packed_transform<Transform, names.size(), packed_transform_size<Transform>(names)>(names);
+		}();
+
+		template <typename T, IsNameTransform Transform, auto Begin, auto End, typename Searcher>
+		consteval auto transformed_names_array()
+		{
+			constexpr const auto& names = transformed_names<T, Transform, Begin, End, Searcher>;
+			std::array<std::string_view, names.size()> result {};
+			for(size_t i = 0; i < names.size(); ++i) result[i] = names[i];
+			return result;
+		}
+	}	 // namespace details
+
+	/// \brief Compile time stringify your enum type, and transform every name (for example into `strtype::kebab_case`).
+	/// \details The transformed names are computed at compile time and stored in a single packed table.
+	/// \returns an `std::array<std::string_view>` with the same order as `strtype::stringify<T>()`.
+	template <details::IsValidStringifyableEnum T,
+			  IsNameTransform Transform,
+			  auto Begin		= details::search_begin<T>(),
+			  auto End			= details::search_end<T>(),
+			  typename Searcher = typename enum_information<T>::SEARCHER>
+	consteval auto stringify()
+	{
+		return details::transformed_names_array<T, Transform, Begin, End, Searcher>();
+	}
+
+	/// \brief Compile time stringify your enum into an associative container using the transformed names.
+	/// \details Lookups from string to value expect the transformed spelling.
+	template <details::IsValidStringifyableEnum T,
+			  IsNameTransform Transform,
+			  auto Begin		= details::search_begin<T>(),
+			  auto End			= details::search_end<T>(),
+			  typename Searcher = typename enum_information<T>::SEARCHER>
+	consteval auto stringify_map()
+	{
+		constexpr auto map	 = stringify_map<T, Begin, End, Searcher>();
+		constexpr auto names = stringify<T, Transform, Begin, End, Searcher>();
+		std::array<T, map.size()> values {};
+		for(size_t i = 0; i < map.size(); ++i) values[i] = map.value_at_index(i);
+		return details::ct_bst<T, map.size(), details::name_slot_size(details::max_name_length(names))>(names, values);
+	}
+
+	namespace details
+	{
+		template <typename T, IsNameTransform Transform>
+		inline constexpr auto transformed_map = stringify_map<T, Transform>();
+	}	 // namespace details
+
+	template <IsNameTransform Transform, details::IsValidStringifyableEnum T>
+	constexpr auto stringify_enum(T value) -> std::string_view
+	{
+		return details::transformed_map<T, Transform>[value];
+	}
+}	 // namespace strtype
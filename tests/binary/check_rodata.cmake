@@ -0,0 +1,28 @@
+# Extracts the read-only data of the test binary, and verifies that none of the signatures the names are parsed from
+# made it in, only the trimmed names should be emitted.
+#
+# Expects: OBJCOPY, BINARY, and OUTPUT_DIR
+set(RODATA ${OUTPUT_DIR}/rodata.bin)
+execute_process(
+    COMMAND ${OBJCOPY} -O binary --only-section=.rodata ${BINARY} ${RODATA}
+    RESULT_VARIABLE RESULT
+    ERROR_VARIABLE ERRORS
+)
+if(NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "failed to extract .rodata from ${BINARY}:\n${ERRORS}")
+endif()
+
+# every signature strtype parses names from is that of `get_signature`, matching on it alone keeps the signatures that
+# other libraries linked into the binary emit (e.g. in their assertion messages) from failing the check
+file(STRINGS ${RODATA} LEAKS REGEX "strtype::details::get_signature")
+if(LEAKS)
+    list(LENGTH LEAKS COUNT)
+    list(GET LEAKS 0 FIRST)
+    message(FATAL_ERROR "found ${COUNT} signature(s) in .rodata, the first being: ${FIRST}")
+endif()
+
+# guard against scanning the wrong section, the trimmed names have to be present
+file(STRINGS ${RODATA} NAMES REGEX "some_other")
+if(NOT NAMES)
+    message(FATAL_ERROR "expected the trimmed enum names in .rodata")
+endif()
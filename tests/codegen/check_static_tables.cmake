@@ -0,0 +1,31 @@
+# Compiles `static_tables.cpp` to assembly for every optimization level, and verifies that no function materializes a
+# copy of a table. The names in a table point to the template parameter objects (mangled as `_ZTAX...`) holding the
+# enum names, so a table built at runtime shows up as instructions loading those addresses.
+#
+# Expects: COMPILER, SOURCE, INCLUDE_DIR, and OUTPUT_DIR
+foreach(LEVEL O0 O1 O2)
+    set(ASSEMBLY ${OUTPUT_DIR}/static_tables_${LEVEL}.s)
+    execute_process(
+        COMMAND ${COMPILER} -std=c++20 -${LEVEL} -I${INCLUDE_DIR} -S ${SOURCE} -o ${ASSEMBLY}
+        RESULT_VARIABLE RESULT
+        ERROR_VARIABLE ERRORS
+    )
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "failed to compile ${SOURCE} at -${LEVEL}:\n${ERRORS}")
+    endif()
+
+    file(STRINGS ${ASSEMBLY} LINES)
+    foreach(LINE IN LISTS LINES)
+        # directives (.quad, .section, ...) are the static table itself, only instructions are of interest
+        if(LINE MATCHES "^[ \t]+[a-z][a-z0-9]*[ \t].*_ZTAX")
+            message(FATAL_ERROR "-${LEVEL}: a table is materialized at runtime, found: ${LINE}")
+        endif()
+    endforeach()
+
+    file(READ ${ASSEMBLY} CONTENT)
+    foreach(SYMBOL stringify_map_v transformed_map)
+        if(NOT CONTENT MATCHES "${SYMBOL}")
+            message(FATAL_ERROR "-${LEVEL}: expected a reference to the static `${SYMBOL}` table")
+        endif()
+    endforeach()
+endforeach()
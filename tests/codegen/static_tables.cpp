@@ -0,0 +1,23 @@
+// compiled to assembly by `check_static_tables.cmake`, every runtime lookup should reference the statically stored
+// tables rather than building a copy of the table on the stack.
+#include "strtype/strtype.hpp"
+
+enum class codegen_enum
+{
+	first,
+	second,
+	third,
+	fourth,
+	fifth,
+	sixth,
+	_BEGIN = first,
+	_END   = sixth,
+};
+
+auto lookup_name(codegen_enum value) -> std::string_view { return strtype::stringify_enum(value); }
+auto lookup_ordinal(codegen_enum value) -> size_t { return strtype::enum_ordinal(value); }
+auto lookup_value(std::string_view value) -> codegen_enum { return strtype::stringify_map_v<codegen_enum>[value]; }
+auto lookup_transformed(codegen_enum value) -> std::string_view
+{
+	return strtype::stringify_enum<strtype::kebab_case>(value);
+}
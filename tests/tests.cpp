@@ -1,6 +1,12 @@
+#include "strtype/enum_set.hpp"
+#include "strtype/members.hpp"
+#include "strtype/registry.hpp"
+#include "strtype/schema.hpp"
 #include "strtype/strtype.hpp"
 
 #include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <string>
 
 enum class foo_known_size
 {
@@ -177,3 +183,568 @@ TEST_CASE("stringify namespace")
 	STATIC_REQUIRE(strtype::stringify_namespace<foobari<foobari<int>>>() == std::string_view {"foos::dor::ri"});
 	STATIC_REQUIRE(strtype::stringify_namespace<int>() == std::string_view {""});
 }
+
+// none of the values are close enough to 0 to be discovered
+enum class undiscoverable : std::int16_t
+{
+	far = 10000,
+};
+
+enum class verb
+{
+	open,
+	close,
+	_BEGIN = open,
+	_END   = close,
+};
+
+enum class target : std::uint8_t
+{
+	door,
+	window,
+	gate,
+	_BEGIN = door,
+	_END   = gate,
+};
+
+TEST_CASE("union lookup")
+{
+	constexpr auto map = strtype::stringify_union_map<verb, target, bit_ops>();
+	STATIC_REQUIRE(map.size() == 10);
+	STATIC_REQUIRE(std::get<verb>(map["close"]) == verb::close);
+	STATIC_REQUIRE(std::get<target>(map["window"]) == target::window);
+	STATIC_REQUIRE(std::get<bit_ops>(map["LOGICAL"]) == bit_ops::LOGICAL);
+	STATIC_REQUIRE(map["gate"].index() == 1);
+	STATIC_REQUIRE(map[target::gate] == "gate");
+	STATIC_REQUIRE(map[bit_ops::SHIFT] == "SHIFT");
+	STATIC_REQUIRE(map.find("missing") == map.end());
+
+	REQUIRE(std::get<verb>(map["open"]) == verb::open);
+	REQUIRE(map.find("door") != map.end());
+	REQUIRE(map.find("doors") == map.end());
+
+	// value lookups share the names of the per enum maps instead of storing copies of them
+	constexpr const auto& stored = strtype::stringify_union_map_v<verb, target, bit_ops>;
+	REQUIRE(stored[verb::open].data() == strtype::stringify_map_v<verb>[verb::open].data());
+
+	constexpr const auto& empty = strtype::stringify_union_map_v<undiscoverable>;
+	STATIC_REQUIRE(empty.size() == 0);
+	REQUIRE(empty.find("far") == empty.end());
+}
+
+TEST_CASE("enum ordinals")
+{
+	STATIC_REQUIRE(strtype::enum_ordinal(foo_with_hole::foo) == 0);
+	STATIC_REQUIRE(strtype::enum_ordinal(foo_with_hole::sin) == 2);
+	REQUIRE(strtype::enum_ordinal(bit_ops::LOGICAL) == 4);
+}
+
+TEST_CASE("schema export")
+{
+	constexpr strtype::schema_view schema {strtype::schema<bit_ops, unreasonably_large, foos::dor::ri::foobari<int>>()};
+	STATIC_REQUIRE(schema.size() == 3);
+	STATIC_REQUIRE((*schema.begin()).name() == "bit_ops");
+	STATIC_REQUIRE((*schema.find("bit_ops")).name_at(4) == "LOGICAL");
+	STATIC_REQUIRE((*schema.find("unreasonably_large")).value_at(0) == -2000);
+	STATIC_REQUIRE((*schema.find("unreasonably_large")).ordinal_of(20) == 2);
+	STATIC_REQUIRE((*schema.find("unreasonably_large")).is_signed());
+	STATIC_REQUIRE((*schema.find("foos::dor::ri::foobari<int>")).empty());
+	STATIC_REQUIRE(schema.find("missing") == schema.end());
+
+	std::string buffer {};
+	strtype::export_schema<bit_ops, foo_with_hole>(std::back_inserter(buffer));
+	strtype::schema_view view {buffer};
+	REQUIRE(view.size() == 2);
+	auto bits = *view.find("bit_ops");
+	REQUIRE(bits.underlying_size() == sizeof(bit_ops));
+	REQUIRE_FALSE(bits.is_signed());
+	REQUIRE(bits.size() == 5);
+	REQUIRE(bits.name_at(strtype::enum_ordinal(bit_ops::ARITHMETIC)) == "ARITHMETIC");
+	REQUIRE(static_cast<std::uint64_t>(bits.value_at(4)) == static_cast<std::uint64_t>(bit_ops::LOGICAL));
+	REQUIRE(bits.ordinal_of(static_cast<std::int64_t>(bit_ops::LOGICAL)) == 4);
+	auto hole = *view.find("foo_with_hole");
+	REQUIRE(hole.name_at(3) == "cos");
+	REQUIRE(hole.value_at(3) == 7);
+
+	REQUIRE_THROWS(strtype::schema_view {std::string_view {buffer}.substr(0, buffer.size() - 1)});
+	REQUIRE_THROWS(strtype::schema_view {std::string_view {"STRA"}});
+}
+
+enum class http_status
+{
+	okStatus,
+	NOT_FOUND,
+	internal_server_error,
+	HTTPVersion2Required,
+	_BEGIN = okStatus,
+	_END   = HTTPVersion2Required,
+};
+
+TEST_CASE("name transforms")
+{
+	constexpr auto kebab = strtype::stringify<http_status, strtype::kebab_case>();
+	STATIC_REQUIRE(kebab.size() == 4);
+	STATIC_REQUIRE(kebab[0] == "ok-status");
+	STATIC_REQUIRE(kebab[1] == "not-found");
+	STATIC_REQUIRE(kebab[2] == "internal-server-error");
+	STATIC_REQUIRE(kebab[3] == "http-version2-required");
+
+	constexpr auto upper = strtype::stringify<http_status, strtype::upper_snake_case>();
+	STATIC_REQUIRE(upper[0] == "OK_STATUS");
+	STATIC_REQUIRE(upper[3] == "HTTP_VERSION2_REQUIRED");
+
+	STATIC_REQUIRE(strtype::stringify<http_status, strtype::camel_case>()[2] == "internalServerError");
+	STATIC_REQUIRE(strtype::stringify<http_status, strtype::pascal_case>()[1] == "NotFound");
+	STATIC_REQUIRE(strtype::stringify<http_status, strtype::title_case>()[2] == "Internal Server Error");
+	STATIC_REQUIRE(strtype::stringify<http_status, strtype::snake_case>()[0] == "ok_status");
+
+	constexpr auto map = strtype::stringify_map<http_status, strtype::kebab_case>();
+	STATIC_REQUIRE(map["not-found"] == http_status::NOT_FOUND);
+	STATIC_REQUIRE(map[http_status::okStatus] == "ok-status");
+	REQUIRE(map["internal-server-error"] == http_status::internal_server_error);
+	REQUIRE(strtype::stringify_enum<strtype::title_case>(http_status::NOT_FOUND) == "Not Found");
+	REQUIRE(strtype::stringify_enum(http_status::NOT_FOUND) == "NOT_FOUND");
+}
+
+TEST_CASE("runtime lookup of dense and sparse enums")
+{
+	const auto& dense = strtype::stringify_map_v<target>;
+	REQUIRE(dense[target::window] == "window");
+	REQUIRE(dense["gate"] == target::gate);
+	REQUIRE(dense.find_index(static_cast<target>(7)) == dense.size());
+	REQUIRE_THROWS(dense[static_cast<target>(200)]);
+
+	const auto& sparse = strtype::stringify_map_v<unreasonably_large>;
+	REQUIRE(sparse[unreasonably_large::some_other] == "some_other");
+	REQUIRE(sparse["and_more"] == unreasonably_large::and_more);
+	REQUIRE(sparse.find_index("and_mor") == sparse.size());
+	REQUIRE_THROWS(sparse["first_"]);
+	REQUIRE_THROWS(sparse[static_cast<unreasonably_large>(21)]);
+}
+
+template <typename Registry>
+concept CanInsertTemporary = requires(Registry& registry) { registry.insert(strtype::type_record {}); };
+
+static const strtype::registrar<bit_ops, unreasonably_large, foos::dor::ri::foobari<int>> registered_types {};
+
+TEST_CASE("runtime registry")
+{
+	const auto* bits = strtype::find_type("bit_ops");
+	REQUIRE(bits != nullptr);
+	REQUIRE(bits->is_enum());
+	REQUIRE(bits->names.size() == 5);
+	REQUIRE(bits->name_of(static_cast<std::int64_t>(bit_ops::LOGICAL)) == "LOGICAL");
+	REQUIRE(bits->name_of(3).empty());
+	REQUIRE(*bits->value_of("SHIFT") == 2);
+	REQUIRE(bits->value_of("MISSING") == nullptr);
+
+	const auto* large = strtype::find_type("unreasonably_large");
+	REQUIRE(large != nullptr);
+	REQUIRE(large->name_of(-2000) == "first");
+	REQUIRE(*large->value_of("some_other") == -51);
+
+	const auto* type = strtype::find_type("foos::dor::ri::foobari<int>");
+	REQUIRE(type != nullptr);
+	REQUIRE_FALSE(type->is_enum());
+	REQUIRE(type->name_of(0).empty());
+
+	REQUIRE(strtype::find_type("foo_known_size") == nullptr);
+	REQUIRE(strtype::register_type<bit_ops>() == bits);
+
+	strtype::basic_registry<2> small {};
+	REQUIRE(small.insert(strtype::details::type_record_v<bit_ops>) != nullptr);
+	REQUIRE(small.insert(strtype::details::type_record_v<verb>) != nullptr);
+	REQUIRE(small.insert(strtype::details::type_record_v<target>) == nullptr);
+	REQUIRE(small.size() == 2);
+	REQUIRE(small.find("verb")->name_of(1) == "close");
+	STATIC_REQUIRE_FALSE(CanInsertTemporary<strtype::basic_registry<2>>);
+}
+
+TEST_CASE("name storage report")
+{
+	constexpr auto verbs = strtype::name_storage<verb>();
+	STATIC_REQUIRE(verbs.type_name == "verb");
+	STATIC_REQUIRE(verbs.type_name_bytes == 5);
+	STATIC_REQUIRE(verbs.count == 2);
+	STATIC_REQUIRE(verbs.name_bytes == sizeof("open") + sizeof("close"));
+	STATIC_REQUIRE(verbs.map_bytes == sizeof(strtype::stringify_map_v<verb>));
+	STATIC_REQUIRE(verbs.total() == verbs.type_name_bytes + verbs.name_bytes + verbs.map_bytes);
+
+	constexpr auto type = strtype::name_storage<foos::dor::ri::foobari<int>>();
+	STATIC_REQUIRE(type.type_name == "foos::dor::ri::foobari<int>");
+	STATIC_REQUIRE(type.count == 0);
+	STATIC_REQUIRE(type.total() == type.type_name_bytes);
+}
+
+enum class unannotated : std::int16_t
+{
+	far_below = -100,
+	below	  = -3,
+	zero	  = 0,
+	one,
+	two,
+	far_above = 90,
+	flag	  = 1 << 12,
+};
+
+enum class small_unannotated : std::uint8_t
+{
+	first = 1,
+	high  = 128,
+};
+
+enum class int8_unannotated : std::int8_t
+{
+	lowest	= -128,
+	highest = 126,
+};
+
+enum class int8_far_values : std::int8_t
+{
+	lowest	= -128,
+	zero	= 0,
+	highest = 126,
+};
+
+enum class uint8_far_values : std::uint8_t
+{
+	zero = 0,
+	flag = 128,
+	last = 254,
+};
+
+enum class errno_codes : std::int32_t
+{
+	ok				   = 0,
+	interrupted		   = -4,
+	again			   = -11,
+	no_memory		   = -12,
+	timed_out		   = -110,
+	refused			   = -111,
+};
+
+namespace strtype
+{
+	template <>
+	struct enum_information<int8_unannotated>
+	{
+		using SEARCHER = strtype::sequential_searcher;
+	};
+}	 // namespace strtype
+
+TEST_CASE("automatic range discovery")
+{
+	constexpr auto values				= strtype::stringify<unannotated>();
+	constexpr std::array correct_values = {"far_below", "below", "zero", "one", "two", "far_above", "flag"};
+	STATIC_REQUIRE(values.size() == correct_values.size());
+	STATIC_REQUIRE(correct_values[0] == values[0]);
+	STATIC_REQUIRE(correct_values[1] == values[1]);
+	STATIC_REQUIRE(correct_values[2] == values[2]);
+	STATIC_REQUIRE(correct_values[5] == values[5]);
+	STATIC_REQUIRE(correct_values[6] == values[6]);
+
+	// the bit probes find values past the windows
+	STATIC_REQUIRE(strtype::stringify<small_unannotated>().size() == 2);
+	STATIC_REQUIRE(strtype::stringify<small_unannotated>()[1] == "high");
+
+	// without the bit probes, or with a single empty window, the values far from 0 are missed
+	STATIC_REQUIRE(strtype::stringify<unannotated,
+									  std::int16_t {-1000},
+									  std::int16_t {1000},
+									  strtype::basic_auto_searcher<16, 2, false, 0>>()
+					 .size() == 6);
+	STATIC_REQUIRE(strtype::stringify<small_unannotated,
+									  std::uint8_t {0},
+									  std::uint8_t {255},
+									  strtype::basic_auto_searcher<1, 1, false, 0>>()
+					 .size() == 0);
+
+	// the 8 bit range is always searched, so no value of an 8 bit type is missed
+	STATIC_REQUIRE(strtype::stringify<int8_far_values>().size() == 3);
+	STATIC_REQUIRE(strtype::stringify<int8_far_values>()[0] == "lowest");
+	STATIC_REQUIRE(strtype::stringify<int8_far_values>()[2] == "highest");
+	STATIC_REQUIRE(strtype::stringify<uint8_far_values>().size() == 3);
+	STATIC_REQUIRE(strtype::stringify<uint8_far_values>()[2] == "last");
+
+	// errno style codes lie past empty windows on the negative side
+	constexpr auto errors				= strtype::stringify<errno_codes>();
+	constexpr std::array correct_errors = {"refused", "timed_out", "no_memory", "again", "interrupted", "ok"};
+	STATIC_REQUIRE(errors.size() == correct_errors.size());
+	STATIC_REQUIRE(errors[0] == correct_errors[0]);
+	STATIC_REQUIRE(errors[1] == correct_errors[1]);
+	STATIC_REQUIRE(errors[2] == correct_errors[2]);
+	STATIC_REQUIRE(errors[5] == correct_errors[5]);
+	REQUIRE(strtype::stringify_enum(errno_codes::timed_out) == "timed_out");
+
+	// the full range of an 8 bit type, except for the (excluded) maximum
+	STATIC_REQUIRE(strtype::stringify<int8_unannotated>().size() == 2);
+
+	constexpr auto map = strtype::stringify_map<unannotated>();
+	STATIC_REQUIRE(map["flag"] == unannotated::flag);
+	REQUIRE(strtype::stringify_enum(unannotated::far_below) == "far_below");
+	REQUIRE(strtype::enum_ordinal(unannotated::far_above) == 5);
+}
+
+enum class long_names
+{
+	a_name_that_does_not_fit_in_a_32_byte_slot,
+	short_name,
+	_BEGIN = a_name_that_does_not_fit_in_a_32_byte_slot,
+	_END   = short_name,
+};
+
+TEST_CASE("fixed width name slots")
+{
+	STATIC_REQUIRE(strtype::max_name_length<verb>() == 5);
+	STATIC_REQUIRE(strtype::max_name_length<http_status>() == 21);
+	STATIC_REQUIRE(strtype::max_name_length<long_names>() == 42);
+
+	STATIC_REQUIRE(strtype::stringify_map_v<verb>.SLOT_SIZE == 16);
+	STATIC_REQUIRE(strtype::stringify_map_v<http_status>.SLOT_SIZE == 32);
+	STATIC_REQUIRE(strtype::stringify_map_v<long_names>.SLOT_SIZE == 0);
+
+	// runtime copies, so the names don't share storage with the tables
+	const std::string close {"close"};
+	const std::string status {"internal_server_error"};
+	const std::string long_name {"a_name_that_does_not_fit_in_a_32_byte_slot"};
+	REQUIRE(strtype::stringify_map_v<verb>[close] == verb::close);
+	REQUIRE(strtype::stringify_map_v<http_status>[status] == http_status::internal_server_error);
+	REQUIRE(strtype::stringify_map_v<long_names>[long_name] == long_names::a_name_that_does_not_fit_in_a_32_byte_slot);
+
+	const std::string padded {"close\0", 6};
+	REQUIRE(strtype::stringify_map_v<verb>.find_index(padded) == strtype::stringify_map_v<verb>.size());
+	REQUIRE(strtype::stringify_map_v<verb>.find_index(status) == strtype::stringify_map_v<verb>.size());
+	REQUIRE(strtype::stringify_map_v<http_status>.find_index("NOT_FOUND") == 1);
+}
+
+TEST_CASE("enum statistics")
+{
+	constexpr auto holes = strtype::enum_stats<foo_with_hole>();
+	STATIC_REQUIRE(holes.type_name == "foo_with_hole");
+	STATIC_REQUIRE(holes.searcher == "strtype::sequential_searcher");
+	STATIC_REQUIRE(holes.begin == 0);
+	STATIC_REQUIRE(holes.end == 9);
+	STATIC_REQUIRE(holes.candidates == 9);
+	STATIC_REQUIRE(holes.count == 5);
+	STATIC_REQUIRE(holes.name_bytes == 15);
+	STATIC_REQUIRE(holes.max_name_length == 3);
+	STATIC_REQUIRE(holes.hash_collisions == 0);
+	STATIC_REQUIRE(holes.perfect_hash);
+	STATIC_REQUIRE_FALSE(holes.dense);
+	STATIC_REQUIRE(holes.slot_size == 16);
+
+	constexpr auto bits = strtype::enum_stats<bit_ops>();
+	STATIC_REQUIRE(bits.candidates == 65);
+	STATIC_REQUIRE(bits.count == 5);
+
+	// [0, 753) and [-256, 0) are searched (the budget of 1024 minus the 15 bit probes, of which 256 are kept for the
+	// negative side), and the 5 bit values past 753
+	constexpr auto discovered = strtype::enum_stats<unannotated>();
+	STATIC_REQUIRE(discovered.searcher.starts_with("strtype::basic_auto_searcher<"));
+	STATIC_REQUIRE(discovered.candidates == 753 + 256 + 5);
+	STATIC_REQUIRE(discovered.count == 7);
+	STATIC_REQUIRE(discovered.density < 0.01);
+
+	constexpr auto negative = strtype::
+	  enum_stats<unannotated, std::int16_t {-200}, std::int16_t {0}, strtype::basic_auto_searcher<16, 2, false, 0>>();
+	STATIC_REQUIRE(negative.candidates == 200);
+	STATIC_REQUIRE(negative.count == 2);
+	STATIC_REQUIRE(strtype::enum_stats<target>().dense);
+}
+
+enum class log_category
+{
+	NET_CONNECT,
+	NET_TIMEOUT_ERROR,
+	DISK_READ,
+	DISK_ERROR,
+	AUTH,
+	_BEGIN = NET_CONNECT,
+	_END   = AUTH,
+};
+
+TEST_CASE("name patterns")
+{
+	STATIC_REQUIRE(strtype::details::glob_match("NET_*", "NET_CONNECT"));
+	STATIC_REQUIRE(strtype::details::glob_match("*_ERROR", "NET_TIMEOUT_ERROR"));
+	STATIC_REQUIRE(strtype::details::glob_match("*T*ERR?R", "NET_TIMEOUT_ERROR"));
+	STATIC_REQUIRE(strtype::details::glob_match("*", ""));
+	STATIC_REQUIRE_FALSE(strtype::details::glob_match("NET_*", "DISK_READ"));
+	STATIC_REQUIRE_FALSE(strtype::details::glob_match("AUTH?", "AUTH"));
+	STATIC_REQUIRE_FALSE(strtype::details::glob_match("", "AUTH"));
+
+	constexpr auto net = strtype::match_names<log_category>("NET_*");
+	STATIC_REQUIRE(net.count() == 2);
+	STATIC_REQUIRE(net.contains(log_category::NET_CONNECT));
+	STATIC_REQUIRE(net.contains(log_category::NET_TIMEOUT_ERROR));
+	STATIC_REQUIRE_FALSE(net.contains(log_category::DISK_ERROR));
+	STATIC_REQUIRE_FALSE(net.contains(static_cast<log_category>(42)));
+
+	constexpr auto errors = strtype::match_names<log_category>("*_ERROR");
+	STATIC_REQUIRE((net & errors).count() == 1);
+	STATIC_REQUIRE((net | errors).count() == 3);
+	STATIC_REQUIRE((~(net | errors)).count() == 2);
+	STATIC_REQUIRE(strtype::match_names<log_category>("*").count() == 5);
+	STATIC_REQUIRE(strtype::match_names<log_category>("NOPE*").empty());
+
+	// patterns loaded at runtime
+	const std::string pattern {"DISK_*"};
+	auto disk = strtype::match_names<log_category>(pattern);
+	REQUIRE(disk.contains(log_category::DISK_READ));
+	REQUIRE(disk.contains(log_category::DISK_ERROR));
+	REQUIRE_FALSE(disk.contains(log_category::AUTH));
+	disk.erase(log_category::DISK_READ);
+	disk.insert(log_category::AUTH);
+	REQUIRE(disk == (strtype::match_names<log_category>("DISK_E*") | strtype::match_names<log_category>("AUTH")));
+	REQUIRE_THROWS(disk.insert(static_cast<log_category>(42)));
+}
+
+TEST_CASE("string composition")
+{
+	constexpr auto key = "http." + strtype::stringify<http_status::NOT_FOUND>() + ".count";
+	STATIC_REQUIRE(std::string_view {key} == "http.NOT_FOUND.count");
+	STATIC_REQUIRE(std::string_view {strtype::concat("a", strtype::fixed_string {"bc"}, "", "d")} == "abcd");
+	STATIC_REQUIRE(std::string_view {strtype::join(".", "http", strtype::stringify<http_status::okStatus>())} ==
+				   "http.okStatus");
+	STATIC_REQUIRE(std::string_view {strtype::join(", ", "single")} == "single");
+	STATIC_REQUIRE(std::string_view {strtype::stringify<http_status::NOT_FOUND>().to_lower()} == "not_found");
+	STATIC_REQUIRE(std::string_view {strtype::stringify<http_status::okStatus>().to_upper()} == "OKSTATUS");
+	constexpr auto error = strtype::stringify<http_status::internal_server_error>();
+	STATIC_REQUIRE(std::string_view {strtype::replace<error, "_", "::">()} == "internal::server::error");
+	STATIC_REQUIRE(std::string_view {strtype::replace<"__a__", "_", "">()} == "a");
+	STATIC_REQUIRE(std::string_view {strtype::replace<"", "_", "-">()}.empty());
+
+	// per value keys, packed in a single table and indexed by ordinal
+	using latency_key = strtype::affix<"http.", ".latency", strtype::snake_case>;
+	constexpr auto keys = strtype::stringify<http_status, latency_key>();
+	STATIC_REQUIRE(keys[0] == "http.ok_status.latency");
+	STATIC_REQUIRE(keys[3] == "http.http_version2_required.latency");
+	STATIC_REQUIRE(strtype::stringify<http_status, strtype::affix<"status/">>()[1] == "status/NOT_FOUND");
+	REQUIRE(strtype::stringify_enum<latency_key>(http_status::NOT_FOUND) == "http.not_found.latency");
+	REQUIRE(keys[strtype::enum_ordinal(http_status::internal_server_error)] == "http.internal_server_error.latency");
+}
+
+namespace wire
+{
+	struct point
+	{
+		int x;
+		double y_2;
+	};
+
+	template <typename T>
+	struct tagged
+	{
+		T value;
+		std::string tag;
+		point at;
+		http_status status;
+	};
+
+	struct empty
+	{};
+}	 // namespace wire
+
+TEST_CASE("aggregate member names")
+{
+	STATIC_REQUIRE(strtype::member_count<wire::point>() == 2);
+	STATIC_REQUIRE(strtype::member_count<wire::tagged<long>>() == 4);
+	STATIC_REQUIRE(strtype::member_count<wire::empty>() == 0);
+
+	constexpr auto names = strtype::member_names<wire::tagged<wire::point>>();
+	STATIC_REQUIRE(names.size() == 4);
+	STATIC_REQUIRE(names[0] == "value");
+	STATIC_REQUIRE(names[1] == "tag");
+	STATIC_REQUIRE(names[2] == "at");
+	STATIC_REQUIRE(names[3] == "status");
+	STATIC_REQUIRE(strtype::member_names<wire::point>()[1] == "y_2");
+	STATIC_REQUIRE(strtype::member_names<wire::empty>().empty());
+
+	constexpr auto weighted_sum = [] {
+		wire::point point {3, 4.0};
+		int result {0};
+		strtype::for_each_member(point, [&result](std::string_view name, const auto& field) {
+			result += static_cast<int>(field) * static_cast<int>(name.size());
+		});
+		return result;
+	}();
+	STATIC_REQUIRE(weighted_sum == 3 * 1 + 4 * 3);
+
+	wire::tagged<int> value {1, "first", {2, 3.0}, http_status::NOT_FOUND};
+	std::string fields {};
+	strtype::for_each_member(value, [&fields](std::string_view name, auto& field) {
+		fields += name;
+		fields += ';';
+		if constexpr(std::is_same_v<std::remove_cvref_t<decltype(field)>, std::string>) field += "_visited";
+	});
+	REQUIRE(fields == "value;tag;at;status;");
+	REQUIRE(value.tag == "first_visited");
+}
+
+TEST_CASE("name rank")
+{
+	// sorted: "HTTPVersion2Required", "NOT_FOUND", "internal_server_error", "okStatus"
+	STATIC_REQUIRE(strtype::name_rank(http_status::HTTPVersion2Required) == 0);
+	STATIC_REQUIRE(strtype::name_rank(http_status::NOT_FOUND) == 1);
+	STATIC_REQUIRE(strtype::name_rank(http_status::internal_server_error) == 2);
+	STATIC_REQUIRE(strtype::name_rank(http_status::okStatus) == 3);
+	STATIC_REQUIRE(strtype::names_sorted<http_status>()[1] == "NOT_FOUND");
+	STATIC_REQUIRE(strtype::value_at_rank<http_status>(2) == http_status::internal_server_error);
+
+	constexpr auto sorted = strtype::names_sorted<log_category>();
+	STATIC_REQUIRE(sorted.size() == 5);
+	STATIC_REQUIRE(sorted[0] == "AUTH");
+	STATIC_REQUIRE(sorted[4] == "NET_TIMEOUT_ERROR");
+	for(size_t rank = 0; rank < sorted.size(); ++rank)
+	{
+		REQUIRE(strtype::name_rank(strtype::value_at_rank<log_category>(rank)) == rank);
+		if(rank > 0) REQUIRE(sorted[rank - 1] < sorted[rank]);
+	}
+	REQUIRE_THROWS(strtype::name_rank(static_cast<log_category>(42)));
+	REQUIRE_THROWS(strtype::value_at_rank<log_category>(5));
+
+	constexpr auto disk = strtype::names_with_prefix<log_category>("DISK_");
+	STATIC_REQUIRE(disk.size() == 2);
+	STATIC_REQUIRE(disk[0] == "DISK_ERROR");
+	STATIC_REQUIRE(disk[1] == "DISK_READ");
+	STATIC_REQUIRE(strtype::names_with_prefix<log_category>("").size() == 5);
+	STATIC_REQUIRE(strtype::names_with_prefix<log_category>("NET_T").size() == 1);
+	STATIC_REQUIRE(strtype::names_with_prefix<log_category>("Z").empty());
+
+	const std::string typed {"NET"};
+	const auto matches = strtype::names_with_prefix<log_category>(typed);
+	REQUIRE(matches.size() == 2);
+	REQUIRE(matches.data() - sorted.data() == 3);
+	REQUIRE(strtype::value_at_rank<log_category>(3) == log_category::NET_CONNECT);
+}
+
+namespace foos::dor::ri
+{
+	template <typename T>
+	struct holder
+	{
+		enum class state
+		{
+			idle,
+			busy,
+		};
+	};
+}	 // namespace foos::dor::ri
+
+TEST_CASE("single value stringify")
+{
+	// the per type offset has to match the one the searchers use, so their instantiations are reused
+	STATIC_REQUIRE(strtype::details::enum_value_offset<foo_known_size> ==
+				   strtype::details::get_known_offset<foo_known_size::foo>());
+	STATIC_REQUIRE(strtype::details::enum_value_offset<unreasonably_large> ==
+				   strtype::details::get_known_offset<unreasonably_large::first>());
+	using state = foos::dor::ri::holder<foos::dor::ri::foobari<int>>::state;
+	STATIC_REQUIRE(strtype::details::enum_value_offset<state> == strtype::details::get_known_offset<state::busy>());
+
+	STATIC_REQUIRE(strtype::stringify<foo_known_size::tan>() == std::string_view {"tan"});
+	STATIC_REQUIRE(strtype::stringify<state::busy>() == std::string_view {"busy"});
+	STATIC_REQUIRE(strtype::stringify<unreasonably_large::some_other>() == std::string_view {"some_other"});
+	STATIC_REQUIRE(strtype::stringify<static_cast<foo_known_size>(3)>().empty());
+	STATIC_REQUIRE(strtype::stringify<static_cast<unreasonably_large>(-51)>() == std::string_view {"some_other"});
+	STATIC_REQUIRE(strtype::stringify<static_cast<unannotated>(-7)>().empty());
+}
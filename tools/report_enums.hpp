@@ -0,0 +1,37 @@
+#pragma once
+// Example input for the `strtype_report` tool, point STRTYPE_REPORT_HEADER and STRTYPE_REPORT_TYPES to your own enums.
+#include <cstdint>
+
+namespace report_example
+{
+	enum class color
+	{
+		red,
+		green,
+		blue,
+		_BEGIN = red,
+		_END   = blue,
+	};
+
+	enum class error_code : std::int32_t
+	{
+		timeout		  = -110,
+		refused		  = -111,
+		ok			  = 0,
+		partial		  = 1,
+		not_supported = 95,
+	};
+
+	enum class permissions : std::uint16_t
+	{
+		none	= 0,
+		read	= 1 << 0,
+		write	= 1 << 1,
+		execute = 1 << 2,
+		admin	= 1 << 15,
+	};
+}	 // namespace report_example
+
+#if !defined(STRTYPE_REPORT_TYPES)
+	#define STRTYPE_REPORT_TYPES report_example::color, report_example::error_code, report_example::permissions
+#endif
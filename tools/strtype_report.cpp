@@ -0,0 +1,85 @@
+// Prints the compile time statistics (see `strtype::enum_stats`) of a list of enums, to find the enums that waste their
+// search budget or end up on a slower lookup path.
+//
+// STRTYPE_REPORT_HEADER is the header that declares the enums (and their `strtype::enum_information`), and
+// STRTYPE_REPORT_TYPES the comma separated list of enums to report on.
+#include "strtype/strtype.hpp"
+
+#include <cstdio>
+#include <string_view>
+#include <type_traits>
+
+#if defined(STRTYPE_REPORT_HEADER)
+	#include STRTYPE_REPORT_HEADER
+#else
+	#include "report_enums.hpp"
+#endif
+
+#if !defined(STRTYPE_REPORT_TYPES)
+	#error "define STRTYPE_REPORT_TYPES as the comma separated list of enums to report on"
+#endif
+
+namespace
+{
+	// below this density the searcher instantiates over 20 values for every name it finds
+	constexpr double sparse_density = 0.05;
+
+	auto print(std::string_view value, int width) -> void
+	{
+		std::printf("%-*.*s", width, static_cast<int>(value.size()), value.data());
+	}
+
+	template <typename T>
+	auto print_value(T value) -> void
+	{
+		if constexpr(std::is_signed_v<T>)
+			std::printf("%lld", static_cast<long long>(value));
+		else
+			std::printf("%llu", static_cast<unsigned long long>(value));
+	}
+
+	template <typename T>
+	auto print_report() -> void
+	{
+		constexpr auto stats = strtype::enum_stats<T>();
+		print(stats.type_name, 32);
+		std::printf(" %10zu %6zu %8.3f %6zu %4zu %4zu  %-7s %-6s %4zu  ",
+					stats.candidates,
+					stats.count,
+					stats.density,
+					stats.name_bytes,
+					stats.max_name_length,
+					stats.hash_collisions,
+					stats.perfect_hash ? "perfect" : "probing",
+					stats.dense ? "index" : "search",
+					stats.slot_size);
+
+		std::printf("[");
+		print_value(stats.begin);
+		std::printf(", ");
+		print_value(stats.end);
+		std::printf(") ");
+		print(stats.searcher, 0);
+		if(stats.density < sparse_density) std::printf(" (sparse)");
+		if(stats.slot_size == 0) std::printf(" (names over 32 bytes)");
+		std::printf("\n");
+	}
+}	 // namespace
+
+int main()
+{
+	std::printf("%-32s %10s %6s %8s %6s %4s %4s  %-7s %-6s %4s  %s\n",
+				"enum",
+				"candidates",
+				"found",
+				"density",
+				"bytes",
+				"max",
+				"coll",
+				"hash",
+				"value",
+				"slot",
+				"range & searcher");
+	[]<typename... Ts>() { (print_report<Ts>(), ...); }.template operator()<STRTYPE_REPORT_TYPES>();
+	return 0;
+}